@@ -0,0 +1,8 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingHandle.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingHandle)
+
+// Handle that points to nothing by default
+const FSettingHandle FSettingHandle::EmptyHandle = FSettingHandle();
@@ -0,0 +1,118 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsCatalog.h"
+//---
+#include "Data/SettingsDataTable.h"
+#include "Data/SettingsRowStore.h"
+#include "MyUtilsLibraries/SettingsUtilsLibrary.h"
+#include "SettingsWidgetConstructorModule.h"
+//---
+#if WITH_EDITOR
+#include "UObject/ObjectSaveContext.h"
+#endif
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsCatalog)
+
+// Returns the baked rows in their final order
+void USettingsCatalog::GetSettingRows(TMap<FName, FSettingsPicker>& OutSettingRows) const
+{
+	OutSettingRows.Empty(RowsInternal.Num());
+
+	if (!ensureMsgf(RowNamesInternal.Num() == RowsInternal.Num(), TEXT("ASSERT: [%i] %hs:\n'%s' is corrupted, amount of row names doesn't match amount of rows!"), __LINE__, __FUNCTION__, *GetNameSafe(this)))
+	{
+		return;
+	}
+
+	for (int32 RowIndex = 0; RowIndex < RowsInternal.Num(); ++RowIndex)
+	{
+		OutSettingRows.Emplace(RowNamesInternal[RowIndex], RowsInternal[RowIndex]);
+	}
+}
+
+// Returns true if this catalog is baked from exactly specified tables, so it can be used instead of them
+bool USettingsCatalog::IsUpToDate(const TSet<const USettingsDataTable*>& DataTables) const
+{
+	if (GIsEditor
+	    || RowsInternal.IsEmpty()
+	    || DataTables.Num() != BakedTablesInternal.Num())
+	{
+		return false;
+	}
+
+	for (const USettingsDataTable* DataTableIt : DataTables)
+	{
+		const int32 BakedIndex = DataTableIt ? BakedTablesInternal.IndexOfByKey(FSoftObjectPath(DataTableIt)) : INDEX_NONE;
+		if (BakedIndex == INDEX_NONE)
+		{
+			// Likely a table from DLC or Game Feature is registered after the cook
+			return false;
+		}
+
+		if (!BakedTablesHashesInternal.IsValidIndex(BakedIndex)
+		    || BakedTablesHashesInternal[BakedIndex] != DataTableIt->GetRowsHash())
+		{
+			// The table is patched or cooked again without this catalog
+			return false;
+		}
+	}
+
+	return true;
+}
+
+#if WITH_EDITOR
+// Merges all source tables into this catalog and precomputes their layout
+void USettingsCatalog::RebuildCatalog()
+{
+	TSet<const USettingsDataTable*> DataTables;
+	if (SourceTablesInternal.IsEmpty())
+	{
+		USettingsUtilsLibrary::GetAllSettingDataTables(/*Out*/ DataTables);
+	}
+	else
+	{
+		for (const TSoftObjectPtr<const USettingsDataTable>& SourceTableIt : SourceTablesInternal)
+		{
+			if (const USettingsDataTable* DataTable = SourceTableIt.LoadSynchronous())
+			{
+				DataTables.Add(DataTable);
+			}
+		}
+	}
+
+	TMap<FName, FSettingsPicker> SettingRows;
+	USettingsUtilsLibrary::GenerateSettingRows(DataTables, /*Out*/ SettingRows);
+
+	BakedTablesInternal.Reset(DataTables.Num());
+	BakedTablesHashesInternal.Reset(DataTables.Num());
+	for (const USettingsDataTable* DataTableIt : DataTables)
+	{
+		BakedTablesInternal.Emplace(DataTableIt);
+		BakedTablesHashesInternal.Emplace(DataTableIt ? DataTableIt->GetRowsHash() : 0);
+	}
+
+	RowNamesInternal.Reset(SettingRows.Num());
+	RowsInternal.Reset(SettingRows.Num());
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingRows)
+	{
+		RowNamesInternal.Emplace(RowIt.Key);
+		RowsInternal.Emplace(RowIt.Value);
+	}
+
+	// Let the runtime index compute the layout, so it's always the same as for live tables
+	FSettingsRowIndex::Make(SettingRows)->ExportLayout(/*Out*/ LayoutInternal);
+
+	UE_LOG(LogSettingsWidgetConstructor, Log, TEXT("%s: baked %i settings from %i tables"), *GetNameSafe(this), RowsInternal.Num(), BakedTablesInternal.Num());
+}
+
+// Is overridden to rebuild the catalog on each save, so cooked catalog always matches the tables
+void USettingsCatalog::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	if (ObjectSaveContext.IsCooking()
+	    || !ObjectSaveContext.IsProceduralSave())
+	{
+		RebuildCatalog();
+	}
+}
+#endif // WITH_EDITOR
@@ -2,7 +2,9 @@
 
 #include "Data/SettingsDataAsset.h"
 //---
+#include "Data/SettingsCatalog.h"
 #include "Data/SettingsDataTable.h"
+#include "Data/SettingsStyleSet.h"
 #include "MyUtilsLibraries/SettingsUtilsLibrary.h"
 //---
 #include "DataRegistry.h"
@@ -23,6 +25,12 @@ UDataRegistry* USettingsDataAsset::GetSettingsDataRegistry() const
 	return SettingsDataRegistryInternal.LoadSynchronous();
 }
 
+// Returns the catalog with all settings pre-merged from Settings Data Tables, is optional and might be null
+const USettingsCatalog* USettingsDataAsset::GetSettingsCatalog() const
+{
+	return SettingsCatalogInternal.LoadSynchronous();
+}
+
 // Overrides post init to register Settings Data Table by default on startup
 void USettingsDataAsset::PostInitProperties()
 {
@@ -50,6 +58,9 @@ void USettingsDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyC
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	// Any theme data could be changed, so cached brushes have to be rebuilt
+	FSettingsStyleSet::Invalidate();
+
 	static const FName PropertyName = GET_MEMBER_NAME_CHECKED(USettingsDataAsset, SettingsDataTableInternal);
 	const FProperty* Property = PropertyChangedEvent.Property;
 	if (Property && Property->GetFName() == PropertyName)
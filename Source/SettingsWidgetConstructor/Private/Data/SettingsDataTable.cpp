@@ -4,6 +4,9 @@
 //---
 #include "Data/SettingsRow.h"
 //---
+#include "Misc/Crc.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+//---
 #if WITH_EDITOR
 #include "DataTableEditorUtils.h" // FDataTableEditorUtils::RenameRow
 #include "Misc/DataValidation.h" // IsDataValid func
@@ -23,6 +26,54 @@ void USettingsDataTable::GetSettingRows(TMap<FName, FSettingsRow>& OutRows) cons
 	GetRows(OutRows);
 }
 
+// Returns the hash of exported rows of this table, is the same in the editor and cooked game for the same rows
+uint32 USettingsDataTable::GetRowsHash() const
+{
+	if (RowsHashInternal.IsSet()
+	    && RowsHashVersionInternal == RowsVersionInternal)
+	{
+		return RowsHashInternal.GetValue();
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsDataTable::GetRowsHash);
+
+	// Rows are exported as text, so hash doesn't depend on memory layout, object addresses and current culture
+	uint32 RowsHash = 0;
+	const UScriptStruct* TableRowStruct = GetRowStruct();
+	if (TableRowStruct)
+	{
+		FString RowText;
+		for (const TTuple<FName, uint8*>& RowIt : GetRowMap())
+		{
+			RowText.Reset();
+			TableRowStruct->ExportText(RowText, RowIt.Value, /*Defaults*/ nullptr, /*OwnerObject*/ nullptr, PPF_None, /*ExportRootScope*/ nullptr);
+			RowsHash = FCrc::StrCrc32(*RowIt.Key.ToString(), RowsHash);
+			RowsHash = FCrc::StrCrc32(*RowText, RowsHash);
+		}
+	}
+
+	RowsHashInternal = RowsHash;
+	RowsHashVersionInternal = RowsVersionInternal;
+	return RowsHash;
+}
+
+// Is overridden to start tracking changes of rows of this table
+void USettingsDataTable::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		OnDataTableChanged().AddUObject(this, &ThisClass::OnRowsChanged);
+	}
+}
+
+// Is bound on any change of this data table to increase the version of its rows
+void USettingsDataTable::OnRowsChanged()
+{
+	++RowsVersionInternal;
+}
+
 #if WITH_EDITOR
 // Called on every change in this data table to automatic set the key name by specified setting tag
 void USettingsDataTable::OnThisDataTableChanged(FName RowKey, const uint8& RowData)
@@ -45,12 +96,12 @@ EDataValidationResult USettingsDataTable::IsDataValid(FDataValidationContext& Co
 {
 	EDataValidationResult Result = CombineDataValidationResults(Super::IsDataValid(Context), EDataValidationResult::Valid);
 
+	// Rows are validated right in the table instead of copying all of them
 	int32 RowIndex = 1; // Tables indexing starts from 1
-	TMap<FName, FSettingsRow> SettingsRows;
-	GetSettingRows(SettingsRows);
-	for (const TTuple<FName, FSettingsRow>& RowIt : SettingsRows)
+	for (const TTuple<FName, uint8*>& RowIt : GetRowMap())
 	{
-		const EDataValidationResult RowResult = RowIt.Value.SettingsPicker.IsDataValid(Context);
+		const FSettingsRow* SettingsRow = reinterpret_cast<const FSettingsRow*>(RowIt.Value);
+		const EDataValidationResult RowResult = SettingsRow ? SettingsRow->SettingsPicker.IsDataValid(Context) : EDataValidationResult::Invalid;
 		Result = CombineDataValidationResults(Result, RowResult);
 		if (RowResult == EDataValidationResult::Invalid)
 		{
@@ -0,0 +1,828 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsEngine.h"
+//---
+#include "SettingsWidgetConstructorModule.h"
+#include "SettingsWidgetConstructorStats.h"
+#include "Data/SettingsSharedCatalog.h"
+#include "MyUtilsLibraries/SettingsUtilsLibrary.h"
+#include "Profiling/SettingsLatencyProfiler.h"
+#include "Subsystems/SettingsCatalogSubsystem.h"
+//---
+#include "GameFramework/GameUserSettings.h"
+
+/*********************************************************************************************
+ * Shared helpers
+ ********************************************************************************************* */
+
+// Binds the owner delegate of specified row and resolves functions of its owner class
+bool FSettingsEngine::BindOwner(FSettingsPrimary& InOutPrimary, const UObject* WorldContext)
+{
+	const FSettingFunctionPicker& Owner = InOutPrimary.Owner;
+	if (!Owner.IsValid())
+	{
+		return false;
+	}
+
+	InOutPrimary.OwnerFunc.BindUFunction(Owner.FunctionClass->GetDefaultObject(), Owner.FunctionName);
+	const UObject* FoundContextObj = InOutPrimary.GetSettingOwner(WorldContext);
+	if (!FoundContextObj)
+	{
+		// Most likely such object is not initialized yet
+		return false;
+	}
+
+	const UClass* ContextClass = FoundContextObj->GetClass();
+	checkf(ContextClass, TEXT("ERROR: [%i] %s:\n'ContextClass' is null!"), __LINE__, *FString(__FUNCTION__));
+
+	// Functions of the same owner class are cached once and shared by all rows and players
+	USettingsCatalogSubsystem* CatalogSubsystem = USettingsCatalogSubsystem::Get(WorldContext);
+	InOutPrimary.OwnerFunctionList = CatalogSubsystem ? CatalogSubsystem->GetOwnerFunctions(*ContextClass) : USettingsCatalogSubsystem::MakeOwnerFunctions(*ContextClass);
+
+	return true;
+}
+
+// Resolves owner objects of all unique owner functions of specified rows and collects functions of their classes in parallel
+void FSettingsEngine::PrefetchOwnerFunctions(const FSettingsRowStore& RowStore, const UObject* WorldContext)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsEngine::PrefetchOwnerFunctions);
+
+	USettingsCatalogSubsystem* CatalogSubsystem = USettingsCatalogSubsystem::Get(WorldContext);
+	if (!CatalogSubsystem)
+	{
+		// There is nowhere to cache functions, e.g: in editor preview
+		return;
+	}
+
+	// Owner objects can be obtained only on the game thread
+	TArray<const UClass*> OwnerClasses;
+	OwnerClasses.Reserve(RowStore.GetOwnerRowIndices().Num());
+	for (const int32 RowIndex : RowStore.GetOwnerRowIndices())
+	{
+		FSettingsPrimary& Primary = RowStore.GetRow(RowIndex).PrimaryData;
+		const FSettingFunctionPicker& Owner = Primary.Owner;
+		if (!Primary.OwnerFunc.IsBound())
+		{
+			Primary.OwnerFunc.BindUFunction(Owner.FunctionClass->GetDefaultObject(), Owner.FunctionName);
+		}
+
+		if (const UObject* OwnerObject = Primary.GetSettingOwner(WorldContext))
+		{
+			OwnerClasses.Emplace(OwnerObject->GetClass());
+		}
+	}
+
+	CatalogSubsystem->CacheOwnerFunctions(OwnerClasses);
+}
+
+// Saves configs of all unique owners of specified rows
+void FSettingsEngine::SaveOwners(const FSettingsRowStore& RowStore, const UObject* WorldContext)
+{
+	// Different owner functions might return the same object, so save each of them only once
+	TSet<UObject*> SavedObjects;
+	SavedObjects.Reserve(RowStore.GetOwnerRowIndices().Num());
+	for (const int32 RowIndex : RowStore.GetOwnerRowIndices())
+	{
+		UObject* ContextObject = RowStore.GetRow(RowIndex).PrimaryData.GetSettingOwner(WorldContext);
+		bool bIsAlreadySaved = false;
+		SavedObjects.Add(ContextObject, &bIsAlreadySaved);
+		if (ContextObject && !bIsAlreadySaved)
+		{
+			ContextObject->SaveConfig();
+		}
+	}
+}
+
+// Applies current Game User Settings on device
+void FSettingsEngine::ApplyGameUserSettings()
+{
+	UGameUserSettings* GameUserSettings = USettingsUtilsLibrary::GetGameUserSettings();
+	if (!GameUserSettings)
+	{
+		return;
+	}
+
+	constexpr bool bCheckForCommandLineOverrides = false;
+	GameUserSettings->ApplySettings(bCheckForCommandLineOverrides);
+}
+
+// Binds delegates of combobox members to functions of its owner object and takes members from the owner
+void FSettingsEngine::BindComboboxMembers(const FSettingsPrimary& Primary, UObject* OwnerObject, FSettingsCombobox& InOutData)
+{
+	const FName GetMembersFunctionName = InOutData.GetMembers.FunctionName;
+	if (Primary.HasOwnerFunction(GetMembersFunctionName))
+	{
+		InOutData.OnGetMembers.BindUFunction(OwnerObject, GetMembersFunctionName);
+		InOutData.OnGetMembers.ExecuteIfBound(InOutData.Members);
+	}
+
+	const FName SetMembersFunctionName = InOutData.SetMembers.FunctionName;
+	if (Primary.HasOwnerFunction(SetMembersFunctionName))
+	{
+		InOutData.OnSetMembers.BindUFunction(OwnerObject, SetMembersFunctionName);
+		InOutData.OnSetMembers.ExecuteIfBound(InOutData.Members);
+	}
+}
+
+/** Returns the value of the getter delegate if bound, otherwise the stored value.
+ * @param Row The row whose value is returned.
+ * @param StoredValue The value stored in the row.
+ * @param GetterDelegate The getter delegate of the row. */
+#define GET_ROW_VALUE(Row, StoredValue, GetterDelegate)           \
+	do                                                            \
+	{                                                             \
+		if (GetterDelegate.IsBound())                             \
+		{                                                         \
+			INC_DWORD_STAT(STAT_SWC_GetterCalls);                 \
+			SWC_SCOPE_SETTING_CALL(Row.PrimaryData.Tag, Getter);  \
+			return GetterDelegate.Execute();                      \
+		}                                                         \
+		return StoredValue;                                       \
+	} while (0)
+
+// Returns is a checkbox toggled
+bool FSettingsEngine::GetCheckboxValue(const FSettingsPicker& Row)
+{
+	GET_ROW_VALUE(Row, Row.Checkbox.bIsSet, Row.Checkbox.OnGetterBool);
+}
+
+// Returns chosen member index of a combobox
+int32 FSettingsEngine::GetComboboxIndex(const FSettingsPicker& Row)
+{
+	GET_ROW_VALUE(Row, Row.Combobox.ChosenMemberIndex, Row.Combobox.OnGetterInt);
+}
+
+// Returns all members of a combobox
+void FSettingsEngine::GetComboboxMembers(const FSettingsPicker& Row, TArray<FText>& OutMembers)
+{
+	OutMembers = Row.Combobox.Members;
+	INC_DWORD_STAT(STAT_SWC_GetterCalls);
+	SWC_SCOPE_SETTING_CALL(Row.PrimaryData.Tag, GetMembers);
+	Row.Combobox.OnGetMembers.ExecuteIfBound(OutMembers);
+}
+
+// Returns current value of a slider [0...1]
+double FSettingsEngine::GetSliderValue(const FSettingsPicker& Row)
+{
+	GET_ROW_VALUE(Row, Row.Slider.ChosenValue, Row.Slider.OnGetterFloat);
+}
+
+// Returns current text of a text line
+void FSettingsEngine::GetTextLineValue(const FSettingsPicker& Row, FText& OutText)
+{
+	OutText = Row.PrimaryData.Caption;
+	INC_DWORD_STAT(STAT_SWC_GetterCalls);
+	SWC_SCOPE_SETTING_CALL(Row.PrimaryData.Tag, Getter);
+	Row.TextLine.OnGetterText.ExecuteIfBound(OutText);
+}
+
+// Returns current input name of a user input
+FName FSettingsEngine::GetUserInputValue(const FSettingsPicker& Row)
+{
+	GET_ROW_VALUE(Row, Row.UserInput.UserInput, Row.UserInput.OnGetterName);
+}
+
+#undef GET_ROW_VALUE
+
+// Calls the setter of the button row
+void FSettingsEngine::PressButton(const FSettingsPicker& Row)
+{
+	INC_DWORD_STAT(STAT_SWC_SetterCalls);
+	SWC_SCOPE_SETTING_CALL(Row.PrimaryData.Tag, Setter);
+	Row.Button.OnButtonPressed.ExecuteIfBound();
+}
+
+/** Stores the value in the row and calls its setter if the value differs from the stored one.
+ * @param Row The row whose value is set.
+ * @param StoredValue The value stored in the row.
+ * @param NewValue The value to set.
+ * @param SetterDelegate The setter delegate of the row. */
+#define SET_ROW_VALUE(Row, StoredValue, NewValue, SetterDelegate) \
+	do                                                            \
+	{                                                             \
+		if (StoredValue == NewValue)                              \
+		{                                                         \
+			return ESettingWriteResult::Redundant;                \
+		}                                                         \
+		StoredValue = NewValue;                                   \
+		INC_DWORD_STAT(STAT_SWC_SetterCalls);                     \
+		SWC_SCOPE_SETTING_CALL(Row.PrimaryData.Tag, Setter);      \
+		SetterDelegate.ExecuteIfBound(NewValue);                  \
+		return ESettingWriteResult::Changed;                      \
+	} while (0)
+
+// Toggles a checkbox
+ESettingWriteResult FSettingsEngine::SetCheckboxValue(FSettingsPicker& InOutRow, bool bNewValue)
+{
+	SET_ROW_VALUE(InOutRow, InOutRow.Checkbox.bIsSet, bNewValue, InOutRow.Checkbox.OnSetterBool);
+}
+
+// Sets chosen member index of a combobox
+ESettingWriteResult FSettingsEngine::SetComboboxIndex(FSettingsPicker& InOutRow, int32 NewValue)
+{
+	if (NewValue == INDEX_NONE)
+	{
+		return ESettingWriteResult::Rejected;
+	}
+
+	SET_ROW_VALUE(InOutRow, InOutRow.Combobox.ChosenMemberIndex, NewValue, InOutRow.Combobox.OnSetterInt);
+}
+
+// Sets the slider value, it's clamped to [0...1] and nearly equal values are treated as the same one
+ESettingWriteResult FSettingsEngine::SetSliderValue(FSettingsPicker& InOutRow, double& InOutValue)
+{
+	InOutValue = FMath::Clamp(InOutValue, 0.0, 1.0);
+
+	// Value loses precision on its way through the string on each refresh, so treat nearly equal value as the same one
+	if (FMath::IsNearlyEqual(InOutRow.Slider.ChosenValue, InOutValue, UE_KINDA_SMALL_NUMBER))
+	{
+		InOutValue = InOutRow.Slider.ChosenValue;
+	}
+
+	SET_ROW_VALUE(InOutRow, InOutRow.Slider.ChosenValue, InOutValue, InOutRow.Slider.OnSetterFloat);
+}
+
+// Sets new text of a text line
+ESettingWriteResult FSettingsEngine::SetTextLineValue(FSettingsPicker& InOutRow, const FText& NewValue)
+{
+	FText& CaptionRef = InOutRow.PrimaryData.Caption;
+	if (CaptionRef.EqualTo(NewValue))
+	{
+		return ESettingWriteResult::Redundant;
+	}
+
+	CaptionRef = NewValue;
+	INC_DWORD_STAT(STAT_SWC_SetterCalls);
+	SWC_SCOPE_SETTING_CALL(InOutRow.PrimaryData.Tag, Setter);
+	InOutRow.TextLine.OnSetterText.ExecuteIfBound(NewValue);
+	return ESettingWriteResult::Changed;
+}
+
+// Sets the user input, it's limited by the max characters number of the row
+ESettingWriteResult FSettingsEngine::SetUserInputValue(FSettingsPicker& InOutRow, FName& InOutValue)
+{
+	if (InOutValue.IsNone())
+	{
+		// Empty input is rejected
+		return ESettingWriteResult::Rejected;
+	}
+
+	const int32 MaxCharactersNumber = InOutRow.UserInput.MaxCharactersNumber;
+	if (MaxCharactersNumber > 0)
+	{
+		// Limit the length of the string
+		const FString NewValueStr = InOutValue.ToString().Left(MaxCharactersNumber);
+		InOutValue = *NewValueStr;
+	}
+
+	FName& UserInputRef = InOutRow.UserInput.UserInput;
+	if (UserInputRef.IsEqual(InOutValue))
+	{
+		return ESettingWriteResult::Redundant;
+	}
+
+	UserInputRef = InOutValue;
+	INC_DWORD_STAT(STAT_SWC_SetterCalls);
+	SWC_SCOPE_SETTING_CALL(InOutRow.PrimaryData.Tag, Setter);
+	InOutRow.UserInput.OnSetterName.ExecuteIfBound(InOutValue);
+	return ESettingWriteResult::Changed;
+}
+
+#undef SET_ROW_VALUE
+
+/*********************************************************************************************
+ * Lifetime
+ ********************************************************************************************* */
+
+// Takes rows of specified tables and binds all of them to their owners
+void FSettingsEngine::Initialize(const UObject* InWorldContext, const TSet<const USettingsDataTable*>& DataTables)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsEngine::Initialize);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_CacheTable);
+
+	TSet<const USettingsDataTable*> AllDataTables;
+	if (DataTables.IsEmpty())
+	{
+		USettingsUtilsLibrary::GetAllSettingDataTables(/*Out*/ AllDataTables);
+	}
+	const TSet<const USettingsDataTable*>& UsedDataTables = DataTables.IsEmpty() ? AllDataTables : DataTables;
+
+	// Rows are merged and indexed once and shared with Settings Widgets, while own copy of rows is made here to bind
+	USettingsCatalogSubsystem* CatalogSubsystem = USettingsCatalogSubsystem::Get(InWorldContext);
+	InitializeRows(InWorldContext, CatalogSubsystem ? CatalogSubsystem->GetSharedCatalog(UsedDataTables) : FSettingsSharedCatalog::Build(UsedDataTables));
+	if (RowStore.Num() == 0)
+	{
+		UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("%hs: there are no settings rows in given tables"), __FUNCTION__);
+		return;
+	}
+
+	PrefetchOwnerFunctions(RowStore, InWorldContext);
+
+	TArray<int32> BoundIndices;
+	BoundIndices.Reserve(RowStore.Num());
+	for (int32 RowIndex = 0; RowIndex < RowStore.Num(); ++RowIndex)
+	{
+		if (BindRow(RowIndex))
+		{
+			BoundIndices.Emplace(RowIndex);
+		}
+		else if (RowStore.GetRow(RowIndex).PrimaryData.Owner.IsValid())
+		{
+			// Owner function is set, but its object is not initialized yet
+			DeferredRowIndices.Emplace(RowIndex);
+		}
+	}
+
+	// Rows still have defaults of the table, so take actual values of owners as the Settings Widget does once constructed
+	RefreshRows(BoundIndices);
+
+	// Values are taken from owners, so there is nothing new to apply
+	bPendingApply = false;
+}
+
+// Takes rows of specified catalog without binding them, so the view binds them by itself
+void FSettingsEngine::InitializeRows(const UObject* InWorldContext, const TSharedRef<const FSettingsSharedCatalog>& InSharedCatalog)
+{
+	Reset();
+
+	WorldContext = InWorldContext;
+	SharedCatalog = InSharedCatalog;
+	bInitialized = true;
+
+	if (InSharedCatalog->Num() > 0)
+	{
+		Rows = InSharedCatalog->Rows;
+		// Only row pointers are bound per engine, while the index of rows is shared with all players
+		RowStore.Build(Rows, InSharedCatalog->Index.ToSharedRef());
+	}
+}
+
+// Returns true if none of tables the rows are taken from was destroyed or changed since then
+bool FSettingsEngine::IsUpToDate() const
+{
+	return SharedCatalog && SharedCatalog->IsUpToDate();
+}
+
+// Releases all rows and their bindings
+void FSettingsEngine::Reset()
+{
+	RowStore.Reset();
+	Rows.Empty();
+	SharedCatalog.Reset();
+	DeferredRowIndices.Empty();
+	BatchChangedIndices.Empty();
+	bPendingApply = false;
+	bInitialized = false;
+}
+
+// Attempts to bind rows whose owners were not initialized yet on previous tries
+int32 FSettingsEngine::TryRebindDeferred()
+{
+	TArray<int32> ReboundIndices;
+	for (int32 Index = DeferredRowIndices.Num() - 1; Index >= 0; --Index)
+	{
+		const int32 RowIndex = DeferredRowIndices[Index];
+		if (BindRow(RowIndex))
+		{
+			ReboundIndices.Emplace(RowIndex);
+			DeferredRowIndices.RemoveAtSwap(Index);
+		}
+	}
+
+	if (ReboundIndices.IsEmpty())
+	{
+		return 0;
+	}
+
+	// Update rebound settings in their order, since each might depend on previous ones
+	ReboundIndices.Sort();
+	RefreshSettings(ReboundIndices, /*bLoadFromConfig*/ true);
+
+	return ReboundIndices.Num();
+}
+
+/*********************************************************************************************
+ * Values
+ ********************************************************************************************* */
+
+// Returns the current value of specified setting in a string format, is taken from its getter if bound
+bool FSettingsEngine::GetSettingValue(FName TagName, FString& OutValue) const
+{
+	return GetRowValue(RowStore.FindIndex(TagName), OutValue);
+}
+
+// Sets the value of specified setting in a string format, it's converted to the setting type
+bool FSettingsEngine::SetSettingValue(FName TagName, const FString& Value)
+{
+	const bool bChanged = WriteRowValue(RowStore.FindIndex(TagName), Value) == ESettingWriteResult::Changed;
+
+	if (bPendingApply
+	    && !IsBatchActive())
+	{
+		ApplySettings();
+	}
+
+	return bChanged;
+}
+
+// Sets values of many settings at once, their dependent settings are refreshed once when all of them are set
+int32 FSettingsEngine::SetSettingsBatch(const TMap<FName, FString>& SettingValues)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsEngine::SetSettingsBatch);
+
+	int32 ChangedNum = 0;
+	BeginBatch();
+	for (const TTuple<FName, FString>& It : SettingValues)
+	{
+		ChangedNum += WriteRowValue(RowStore.FindIndex(It.Key), It.Value) == ESettingWriteResult::Changed ? 1 : 0;
+	}
+	EndBatch();
+
+	if (bPendingApply
+	    && !IsBatchActive())
+	{
+		ApplySettings();
+	}
+
+	return ChangedNum;
+}
+
+// Sets the value of specified row in a string format as SetSettingValue does, but doesn't apply settings
+ESettingWriteResult FSettingsEngine::WriteRowValue(int32 RowIndex, const FString& Value)
+{
+	if (!RowStore.IsValidIndex(RowIndex))
+	{
+		return ESettingWriteResult::Rejected;
+	}
+
+	const ESettingArchetype Archetype = RowStore.GetArchetype(RowIndex);
+	return WriteRow(RowIndex, [Archetype, &Value](FSettingsPicker& Row)
+	{
+		return SetStringValue(Row, Archetype, Value);
+	});
+}
+
+// Writes the value of specified row by given function, the row is synced with its getter before
+ESettingWriteResult FSettingsEngine::WriteRow(int32 RowIndex, TFunctionRef<ESettingWriteResult(FSettingsPicker&)> WriteFunction)
+{
+	if (!RowStore.IsValidIndex(RowIndex))
+	{
+		return ESettingWriteResult::Rejected;
+	}
+
+	const bool bWasOutdated = SyncRowValue(RowIndex);
+	const ESettingWriteResult WriteResult = WriteFunction(RowStore.GetRow(RowIndex));
+	if (bWasOutdated
+	    && WriteResult == ESettingWriteResult::Redundant)
+	{
+		// The owner already has this value, while views still show the previous one
+		OnSettingChangedDelegate.Broadcast(RowStore.GetTag(RowIndex));
+	}
+
+	return CommitRowWrite(RowIndex, WriteResult);
+}
+
+// Starts the batch, dependent settings of rows changed during it are refreshed once when the outermost batch is finished
+void FSettingsEngine::BeginBatch()
+{
+	++BatchDepth;
+}
+
+// Finishes the batch started by BeginBatch
+void FSettingsEngine::EndBatch()
+{
+	if (!ensureMsgf(BatchDepth > 0, TEXT("ASSERT: [%i] %hs:\n'BatchDepth' is zero, EndBatch is called without BeginBatch!"), __LINE__, __FUNCTION__))
+	{
+		return;
+	}
+
+	--BatchDepth;
+	if (BatchDepth > 0)
+	{
+		// Is the nested batch, the outer one will finish it
+		return;
+	}
+
+	// Refresh dependencies of all changed settings at once in rows order, each dependent setting is refreshed only once
+	TArray<int32> Dependencies;
+	for (const int32 RowIndex : BatchChangedIndices)
+	{
+		for (const int32 DependencyIndex : RowStore.GetDependencies(RowIndex))
+		{
+			Dependencies.AddUnique(DependencyIndex);
+		}
+	}
+	BatchChangedIndices.Reset();
+	Dependencies.Sort();
+	RefreshRows(Dependencies);
+}
+
+// Takes values of specified rows from their getters and sets them, configs of their owners are reloaded first if requested
+void FSettingsEngine::RefreshSettings(TConstArrayView<int32> RowIndices, bool bLoadFromConfig/* = false*/)
+{
+	if (bLoadFromConfig)
+	{
+		// Different rows might have the same owner, so load each of them only once
+		TSet<UObject*> LoadedObjects;
+		LoadedObjects.Reserve(RowIndices.Num());
+		for (const int32 RowIndex : RowIndices)
+		{
+			UObject* ContextObject = RowStore.IsValidIndex(RowIndex) ? RowStore.GetRow(RowIndex).PrimaryData.GetSettingOwner(WorldContext.Get()) : nullptr;
+			bool bIsAlreadyLoaded = false;
+			LoadedObjects.Add(ContextObject, &bIsAlreadyLoaded);
+			if (ContextObject && !bIsAlreadyLoaded)
+			{
+				ContextObject->LoadConfig();
+			}
+		}
+	}
+
+	RefreshRows(RowIndices);
+}
+
+// Refreshes settings that depend on specified row, is postponed until the batch is finished
+void FSettingsEngine::RefreshDependencies(int32 RowIndex)
+{
+	if (!RowStore.IsValidIndex(RowIndex))
+	{
+		return;
+	}
+
+	if (IsBatchActive())
+	{
+		// Dependent settings will be refreshed together once the batch is finished
+		BatchChangedIndices.AddUnique(RowIndex);
+		return;
+	}
+
+	// Copy since dependencies might be refreshed during the pass
+	const TArray<int32, TInlineAllocator<16>> Dependencies(RowStore.GetDependencies(RowIndex));
+	RefreshRows(Dependencies);
+}
+
+// Reloads configs of all owners and refreshes all settings by their getters
+void FSettingsEngine::ReloadSettings()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsEngine::ReloadSettings);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_UpdateSettingsByTags);
+
+	TArray<int32> RowIndices;
+	RowIndices.Reserve(RowStore.Num());
+	for (int32 RowIndex = 0; RowIndex < RowStore.Num(); ++RowIndex)
+	{
+		RowIndices.Emplace(RowIndex);
+	}
+	RefreshSettings(RowIndices, /*bLoadFromConfig*/ true);
+}
+
+// Applies current settings on device
+void FSettingsEngine::ApplySettings()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsEngine::ApplySettings);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_ApplySettings);
+
+	bPendingApply = false;
+	ApplyGameUserSettings();
+}
+
+// Applies current settings and saves all owners into their configs
+void FSettingsEngine::SaveSettings()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsEngine::SaveSettings);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_SaveSettings);
+
+	ApplySettings();
+	SaveOwners(RowStore, WorldContext.Get());
+}
+
+/*********************************************************************************************
+ * Internal
+ ********************************************************************************************* */
+
+// Binds getter and setter delegates of specified row to its owner
+bool FSettingsEngine::BindRow(int32 RowIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsEngine::BindRow);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_BindSetting);
+
+	FSettingsPicker& Row = RowStore.GetRow(RowIndex);
+	FSettingsPrimary& Primary = Row.PrimaryData;
+	if (!BindOwner(Primary, WorldContext.Get()))
+	{
+		return false;
+	}
+
+	UObject* OwnerObject = Primary.GetSettingOwner(WorldContext.Get());
+	switch (RowStore.GetArchetype(RowIndex))
+	{
+	case ESettingArchetype::Button:
+		BindFunctions(Primary, OwnerObject, Row.Button.OnButtonPressed, Row.Button.OnButtonPressed);
+		break;
+	case ESettingArchetype::Checkbox:
+		BindFunctions(Primary, OwnerObject, Row.Checkbox.OnGetterBool, Row.Checkbox.OnSetterBool);
+		break;
+	case ESettingArchetype::Combobox:
+		BindFunctions(Primary, OwnerObject, Row.Combobox.OnGetterInt, Row.Combobox.OnSetterInt);
+		BindComboboxMembers(Primary, OwnerObject, Row.Combobox);
+		break;
+	case ESettingArchetype::Slider:
+		BindFunctions(Primary, OwnerObject, Row.Slider.OnGetterFloat, Row.Slider.OnSetterFloat);
+		break;
+	case ESettingArchetype::TextLine:
+		BindFunctions(Primary, OwnerObject, Row.TextLine.OnGetterText, Row.TextLine.OnSetterText);
+		break;
+	case ESettingArchetype::UserInput:
+		BindFunctions(Primary, OwnerObject, Row.UserInput.OnGetterName, Row.UserInput.OnSetterName);
+		break;
+	default:
+		// Custom widgets have no value without UI
+		break;
+	}
+
+	return true;
+}
+
+// Returns the current value of specified row, see GetSettingValue
+bool FSettingsEngine::GetRowValue(int32 RowIndex, FString& OutValue) const
+{
+	if (!RowStore.IsValidIndex(RowIndex))
+	{
+		return false;
+	}
+
+	const FSettingsPicker& Row = RowStore.GetRow(RowIndex);
+	switch (RowStore.GetArchetype(RowIndex))
+	{
+	case ESettingArchetype::Checkbox:
+		OutValue = GetCheckboxValue(Row) ? TEXT("true") : TEXT("false");
+		return true;
+	case ESettingArchetype::Combobox:
+		OutValue = FString::Printf(TEXT("%d"), GetComboboxIndex(Row));
+		return true;
+	case ESettingArchetype::Slider:
+		OutValue = FString::Printf(TEXT("%f"), GetSliderValue(Row));
+		return true;
+	case ESettingArchetype::TextLine:
+	{
+		FText Value;
+		GetTextLineValue(Row, /*Out*/ Value);
+		OutValue = Value.ToString();
+		return true;
+	}
+	case ESettingArchetype::UserInput:
+		OutValue = GetUserInputValue(Row).ToString();
+		return true;
+	default:
+		// Buttons have no value, custom widgets have no value without UI
+		return false;
+	}
+}
+
+// Converts the string value to the type of specified archetype and sets it by its typed setter
+ESettingWriteResult FSettingsEngine::SetStringValue(FSettingsPicker& InOutRow, ESettingArchetype Archetype, const FString& Value)
+{
+	switch (Archetype)
+	{
+	case ESettingArchetype::Button:
+		PressButton(InOutRow);
+		return ESettingWriteResult::Changed;
+	case ESettingArchetype::Checkbox:
+		return SetCheckboxValue(InOutRow, Value.ToBool());
+	case ESettingArchetype::Combobox:
+		return SetComboboxIndex(InOutRow, Value.IsNumeric() ? FCString::Atoi(*Value) : INDEX_NONE);
+	case ESettingArchetype::Slider:
+	{
+		double NewValue = FCString::Atod(*Value);
+		return SetSliderValue(InOutRow, NewValue);
+	}
+	case ESettingArchetype::TextLine:
+		return SetTextLineValue(InOutRow, FText::FromString(Value));
+	case ESettingArchetype::UserInput:
+	{
+		FName NewValue = *Value;
+		return SetUserInputValue(InOutRow, NewValue);
+	}
+	default:
+		// Custom widgets can't be set by the string
+		return ESettingWriteResult::Rejected;
+	}
+}
+
+// Sets the value of specified row without syncing it first, is used to refresh the row by the value of its own getter
+bool FSettingsEngine::SetRowValue(int32 RowIndex, const FString& Value)
+{
+	if (!RowStore.IsValidIndex(RowIndex))
+	{
+		return false;
+	}
+
+	const ESettingWriteResult WriteResult = SetStringValue(RowStore.GetRow(RowIndex), RowStore.GetArchetype(RowIndex), Value);
+	return CommitRowWrite(RowIndex, WriteResult) == ESettingWriteResult::Changed;
+}
+
+/** Stores the value taken from the getter in the row and returns from the function whether the stored one was outdated.
+ * @param StoredValue The value stored in the row.
+ * @param ActualValue The value taken from the getter. */
+#define SYNC_ROW_VALUE(StoredValue, ActualValue)         \
+	do                                                   \
+	{                                                    \
+		const auto Value = ActualValue;                  \
+		const bool bOutdated = StoredValue != Value;     \
+		StoredValue = Value;                             \
+		return bOutdated;                                \
+	} while (0)
+
+// Takes the value of specified row from its getter into the row, so the new value is compared with the actual value of the owner instead of the cached one
+bool FSettingsEngine::SyncRowValue(int32 RowIndex)
+{
+	if (!RowStore.IsValidIndex(RowIndex))
+	{
+		return false;
+	}
+
+	FSettingsPicker& Row = RowStore.GetRow(RowIndex);
+	switch (RowStore.GetArchetype(RowIndex))
+	{
+	case ESettingArchetype::Checkbox:
+		SYNC_ROW_VALUE(Row.Checkbox.bIsSet, GetCheckboxValue(Row));
+	case ESettingArchetype::Combobox:
+		SYNC_ROW_VALUE(Row.Combobox.ChosenMemberIndex, GetComboboxIndex(Row));
+	case ESettingArchetype::Slider:
+		SYNC_ROW_VALUE(Row.Slider.ChosenValue, GetSliderValue(Row));
+	case ESettingArchetype::UserInput:
+		SYNC_ROW_VALUE(Row.UserInput.UserInput, GetUserInputValue(Row));
+	case ESettingArchetype::TextLine:
+	{
+		FText Value;
+		GetTextLineValue(Row, /*Out*/ Value);
+		const bool bOutdated = !Row.PrimaryData.Caption.EqualTo(Value);
+		Row.PrimaryData.Caption = Value;
+		return bOutdated;
+	}
+	default:
+		// Buttons have no value, custom widgets have no value without UI
+		return false;
+	}
+}
+
+#undef SYNC_ROW_VALUE
+
+// Counts the redundant write or reports the change of specified row
+ESettingWriteResult FSettingsEngine::CommitRowWrite(int32 RowIndex, ESettingWriteResult WriteResult)
+{
+	if (WriteResult == ESettingWriteResult::Redundant)
+	{
+		++RedundantWritesNum;
+		INC_DWORD_STAT(STAT_SWC_RedundantWritesAvoided);
+	}
+	else if (WriteResult == ESettingWriteResult::Changed)
+	{
+		OnRowChanged(RowIndex);
+	}
+
+	return WriteResult;
+}
+
+// Is called when the value of specified row is changed to notify views and refresh its dependent settings
+void FSettingsEngine::OnRowChanged(int32 RowIndex)
+{
+	bPendingApply |= RowStore.HasFlag(RowIndex, ESettingRowFlags::ApplyImmediately);
+
+	OnSettingChangedDelegate.Broadcast(RowStore.GetTag(RowIndex));
+
+	RefreshDependencies(RowIndex);
+}
+
+// Takes values of specified rows from their getters and sets them, so their setters and dependent settings are updated in turn
+void FSettingsEngine::RefreshRows(TConstArrayView<int32> RowIndices)
+{
+	// Setters of refreshed settings might change their dependent settings in turn, so cyclic dependencies are cut off here
+	static constexpr int32 MaxPropagationDepth = 32;
+	if (!ensureMsgf(PropagationDepth < MaxPropagationDepth, TEXT("ASSERT: [%i] %hs:\n'PropagationDepth' exceeds %i, most likely 'Settings To Update' have cyclic dependency!"), __LINE__, __FUNCTION__, MaxPropagationDepth))
+	{
+		return;
+	}
+
+	TGuardValue<int32> PropagationDepthGuard(PropagationDepth, PropagationDepth + 1);
+	if (PropagationDepthFrame != GFrameCounter || PropagationDepth > FramePropagationDepth)
+	{
+		PropagationDepthFrame = GFrameCounter;
+		FramePropagationDepth = PropagationDepth;
+		SET_DWORD_STAT(STAT_SWC_PropagationDepth, FramePropagationDepth);
+	}
+
+	for (const int32 RowIndex : RowIndices)
+	{
+		if (!RowStore.IsValidIndex(RowIndex)
+		    || !RowStore.HasFlag(RowIndex, ESettingRowFlags::CanUpdate))
+		{
+			continue;
+		}
+
+		FString Value;
+		if (GetRowValue(RowIndex, /*Out*/ Value))
+		{
+			SetRowValue(RowIndex, Value);
+		}
+	}
+}
@@ -2,6 +2,8 @@
 
 #include "Data/SettingsRow.h"
 //---
+#include "Profiling/SettingsLatencyProfiler.h"
+//---
 #if WITH_EDITOR
 #include "Misc/DataValidation.h" // IsDataValid func
 #endif
@@ -62,6 +64,7 @@ UObject* FSettingsPrimary::GetSettingOwner(const UObject* WorldContext) const
 {
 	if (OwnerFunc.IsBound())
 	{
+		SWC_SCOPE_SETTING_CALL(Tag, Owner);
 		return OwnerFunc.Execute(WorldContext);
 	}
 
@@ -0,0 +1,322 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsRowStore.h"
+//---
+#include "Data/SettingsCatalog.h"
+#include "Data/SettingsRow.h"
+//---
+#include "Async/ParallelFor.h"
+#include "GameplayTagsManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+//---
+#include <atomic>
+
+namespace SettingsRowStore
+{
+	/** The generation given to the next rebuilt store, is shared by all stores, so handles of one store never resolve in another one. */
+	std::atomic<uint32> NextGeneration{1};
+}
+
+// Returns the archetype by specified name of the FSettingsPicker member, e.g: 'Checkbox'
+ESettingArchetype FSettingsRowStore::GetArchetypeByName(FName SettingsType)
+{
+	static const TMap<FName, ESettingArchetype> ArchetypesByName = {
+		{GET_MEMBER_NAME_CHECKED(FSettingsPicker, Button), ESettingArchetype::Button},
+		{GET_MEMBER_NAME_CHECKED(FSettingsPicker, Checkbox), ESettingArchetype::Checkbox},
+		{GET_MEMBER_NAME_CHECKED(FSettingsPicker, Combobox), ESettingArchetype::Combobox},
+		{GET_MEMBER_NAME_CHECKED(FSettingsPicker, Slider), ESettingArchetype::Slider},
+		{GET_MEMBER_NAME_CHECKED(FSettingsPicker, TextLine), ESettingArchetype::TextLine},
+		{GET_MEMBER_NAME_CHECKED(FSettingsPicker, UserInput), ESettingArchetype::UserInput},
+		{GET_MEMBER_NAME_CHECKED(FSettingsPicker, CustomWidget), ESettingArchetype::CustomWidget}
+	};
+
+	const ESettingArchetype* FoundArchetype = ArchetypesByName.Find(SettingsType);
+	return FoundArchetype ? *FoundArchetype : ESettingArchetype::None;
+}
+
+// Creates the index of specified rows, their order is kept
+TSharedRef<const FSettingsRowIndex> FSettingsRowIndex::Make(const TMap<FName, FSettingsPicker>& InRows, const FSettingsCatalogLayout* PrecomputedLayout/* = nullptr*/)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsRowIndex::Make);
+
+	const TSharedRef<FSettingsRowIndex> NewIndex = MakeShared<FSettingsRowIndex>();
+	FSettingsRowIndex& Index = NewIndex.Get();
+
+	const int32 RowsNum = InRows.Num();
+	const bool bUseLayout = PrecomputedLayout && PrecomputedLayout->IsValidFor(RowsNum);
+	const EParallelForFlags ParallelForFlags = RowsNum >= FSettingsRowStore::MinParallelRowsNum ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+	TArray<const FSettingsPicker*> Rows;
+	Rows.Reserve(RowsNum);
+	Index.IndexByName.Reserve(RowsNum);
+	for (const TTuple<FName, FSettingsPicker>& RowIt : InRows)
+	{
+		Index.IndexByName.Emplace(RowIt.Key, Rows.Emplace(&RowIt.Value));
+	}
+
+	Index.Tags.SetNum(RowsNum);
+	Index.Archetypes.SetNum(RowsNum);
+	Index.Flags.SetNum(RowsNum);
+	Index.Getters.SetNum(RowsNum);
+	Index.Setters.SetNum(RowsNum);
+
+	// Prepare: each row is read by itself, so pure data of all rows is resolved in parallel
+	TArray<FGameplayTagContainer> MatchingTags;
+	MatchingTags.SetNum(RowsNum);
+	ParallelFor(RowsNum, [&Index, &Rows, &MatchingTags](int32 RowIndex)
+	{
+		const FSettingsPicker& Setting = *Rows[RowIndex];
+		const FSettingsPrimary& Primary = Setting.PrimaryData;
+
+		Index.Tags[RowIndex] = Primary.Tag;
+		Index.Archetypes[RowIndex] = FSettingsRowStore::GetArchetypeByName(Setting.SettingsType);
+		Index.Getters[RowIndex] = Primary.Getter;
+		Index.Setters[RowIndex] = Primary.Setter;
+
+		ESettingRowFlags RowFlags = ESettingRowFlags::None;
+		if (Primary.bApplyImmediately)
+		{
+			RowFlags |= ESettingRowFlags::ApplyImmediately;
+		}
+		if (Primary.bApplyResolution)
+		{
+			RowFlags |= ESettingRowFlags::ApplyResolution;
+		}
+		if (Primary.bStartOnNextColumn)
+		{
+			RowFlags |= ESettingRowFlags::StartOnNextColumn;
+		}
+		const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
+		if (ChosenData && ChosenData->CanUpdateSetting())
+		{
+			RowFlags |= ESettingRowFlags::CanUpdate;
+		}
+		Index.Flags[RowIndex] = RowFlags;
+
+		// Setting is matched by own tag and all its parents, e.g: 'Settings.Checkbox.VSync' is matched by 'Settings.Checkbox'
+		if (Primary.Tag.IsValid())
+		{
+			MatchingTags[RowIndex] = UGameplayTagsManager::Get().RequestGameplayTagParents(Primary.Tag);
+		}
+	}, ParallelForFlags);
+
+	// Commit: data that depends on previous rows is gathered in rows order
+	TMap<FSettingFunctionPicker, int32> OwnerIndexByFunction;
+	Index.OwnerIndices.Reserve(RowsNum);
+	Index.ColumnIndices.Reserve(RowsNum);
+	int32 ColumnIndex = 0;
+	for (int32 RowIndex = 0; RowIndex < RowsNum; ++RowIndex)
+	{
+		if (Index.HasFlag(RowIndex, ESettingRowFlags::StartOnNextColumn))
+		{
+			++ColumnIndex;
+		}
+		Index.ColumnIndices.Emplace(ColumnIndex);
+
+		int32 OwnerIndex = INDEX_NONE;
+		const FSettingFunctionPicker& Owner = Rows[RowIndex]->PrimaryData.Owner;
+		if (Owner.IsValid())
+		{
+			if (const int32* FoundOwnerIndex = OwnerIndexByFunction.Find(Owner))
+			{
+				OwnerIndex = *FoundOwnerIndex;
+			}
+			else
+			{
+				OwnerIndex = Index.OwnerRowIndices.Emplace(RowIndex);
+				OwnerIndexByFunction.Emplace(Owner, OwnerIndex);
+			}
+		}
+		Index.OwnerIndices.Emplace(OwnerIndex);
+
+		for (const FGameplayTag& MatchingTagIt : MatchingTags[RowIndex])
+		{
+			Index.IndicesByMatchingTag.FindOrAdd(MatchingTagIt.GetTagName()).Emplace(RowIndex);
+		}
+	}
+
+	if (bUseLayout)
+	{
+		// Columns and dependencies are already baked into the catalog
+		Index.ColumnIndices = PrecomputedLayout->ColumnIndices;
+		Index.DependencyOffsets = PrecomputedLayout->DependencyOffsets;
+		Index.DependencyIndices = PrecomputedLayout->DependencyIndices;
+		return NewIndex;
+	}
+
+	// Dependencies are resolved once all rows are indexed, since rows can depend on next ones
+	TArray<TArray<int32>> RowDependencies;
+	RowDependencies.SetNum(RowsNum);
+	ParallelFor(RowsNum, [&Index, &Rows, &RowDependencies](int32 RowIndex)
+	{
+		Index.FindIndicesByTags(Rows[RowIndex]->PrimaryData.SettingsToUpdate, /*Out*/ RowDependencies[RowIndex]);
+	}, ParallelForFlags);
+
+	Index.DependencyOffsets.Reserve(RowsNum + 1);
+	for (const TArray<int32>& RowDependenciesIt : RowDependencies)
+	{
+		Index.DependencyOffsets.Emplace(Index.DependencyIndices.Num());
+		Index.DependencyIndices.Append(RowDependenciesIt);
+	}
+	Index.DependencyOffsets.Emplace(Index.DependencyIndices.Num());
+
+	return NewIndex;
+}
+
+// Returns the index of the row by its tag name or INDEX_NONE if not found
+int32 FSettingsRowIndex::FindIndex(FName TagName) const
+{
+	const int32* FoundIndex = IndexByName.Find(TagName);
+	return FoundIndex ? *FoundIndex : INDEX_NONE;
+}
+
+// Returns indices of rows whose tags match any of specified tags, sorted by rows order
+void FSettingsRowIndex::FindIndicesByTags(const FGameplayTagContainer& InTags, TArray<int32>& OutRowIndices) const
+{
+	OutRowIndices.Reset();
+
+	for (const FGameplayTag& TagIt : InTags)
+	{
+		if (const TArray<int32>* FoundIndices = IndicesByMatchingTag.Find(TagIt.GetTagName()))
+		{
+			OutRowIndices.Append(*FoundIndices);
+		}
+	}
+
+	if (InTags.Num() > 1)
+	{
+		// Same row might be matched by a few tags
+		OutRowIndices.Sort();
+		for (int32 Index = OutRowIndices.Num() - 1; Index > 0; --Index)
+		{
+			if (OutRowIndices[Index] == OutRowIndices[Index - 1])
+			{
+				OutRowIndices.RemoveAt(Index, 1, EAllowShrinking::No);
+			}
+		}
+	}
+}
+
+// Returns indices of rows to update once specified row is changed, are resolved from its 'Settings To Update'
+TConstArrayView<int32> FSettingsRowIndex::GetDependencies(int32 RowIndex) const
+{
+	if (!DependencyOffsets.IsValidIndex(RowIndex + 1))
+	{
+		return {};
+	}
+
+	const int32 Offset = DependencyOffsets[RowIndex];
+	return TConstArrayView<int32>(DependencyIndices.GetData() + Offset, DependencyOffsets[RowIndex + 1] - Offset);
+}
+
+// Returns bytes allocated by all arrays and maps of this index
+SIZE_T FSettingsRowIndex::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = Tags.GetAllocatedSize()
+		+ Archetypes.GetAllocatedSize()
+		+ Flags.GetAllocatedSize()
+		+ ColumnIndices.GetAllocatedSize()
+		+ OwnerIndices.GetAllocatedSize()
+		+ Getters.GetAllocatedSize()
+		+ Setters.GetAllocatedSize()
+		+ OwnerRowIndices.GetAllocatedSize()
+		+ DependencyOffsets.GetAllocatedSize()
+		+ DependencyIndices.GetAllocatedSize()
+		+ IndexByName.GetAllocatedSize()
+		+ IndicesByMatchingTag.GetAllocatedSize();
+
+	for (const TTuple<FName, TArray<int32>>& It : IndicesByMatchingTag)
+	{
+		AllocatedSize += It.Value.GetAllocatedSize();
+	}
+
+	return AllocatedSize;
+}
+
+// Copies columns and dependencies of this index into specified layout, so next indices of the same rows don't compute them again
+void FSettingsRowIndex::ExportLayout(FSettingsCatalogLayout& OutLayout) const
+{
+	OutLayout.ColumnIndices = ColumnIndices;
+	OutLayout.DependencyOffsets = DependencyOffsets;
+	OutLayout.DependencyIndices = DependencyIndices;
+}
+
+// Rebuilds the store by specified rows with own new index, their order is kept
+void FSettingsRowStore::Build(TMap<FName, FSettingsPicker>& InRows, const FSettingsCatalogLayout* PrecomputedLayout/* = nullptr*/)
+{
+	Build(InRows, FSettingsRowIndex::Make(InRows, PrecomputedLayout));
+}
+
+// Rebuilds the store by specified rows bound to already built index, so nothing but row pointers is computed
+void FSettingsRowStore::Build(TMap<FName, FSettingsPicker>& InRows, const TSharedRef<const FSettingsRowIndex>& InIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsRowStore::Build);
+
+	Reset();
+
+	const int32 RowsNum = InRows.Num();
+	checkf(InIndex->Num() == RowsNum, TEXT("ERROR: [%i] %hs:\nIndex of %i rows can't be bound to %i rows!"), __LINE__, __FUNCTION__, InIndex->Num(), RowsNum);
+
+	Index = InIndex;
+	SourceRows = &InRows;
+	Rows.Reserve(RowsNum);
+	Widgets.Reserve(RowsNum);
+	for (TTuple<FName, FSettingsPicker>& RowIt : InRows)
+	{
+		Rows.Emplace(&RowIt.Value);
+		Widgets.Emplace(RowIt.Value.PrimaryData.SettingSubWidget);
+	}
+}
+
+// Clears all arrays
+void FSettingsRowStore::Reset()
+{
+	Index.Reset();
+	Widgets.Reset();
+	Rows.Reset();
+	SourceRows = nullptr;
+
+	Generation = SettingsRowStore::NextGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Returns true if this store is built for specified rows and none of them was added or removed since then
+bool FSettingsRowStore::IsBuiltFor(const TMap<FName, FSettingsPicker>& InRows) const
+{
+	return SourceRows == &InRows && InRows.Num() == Rows.Num();
+}
+
+// Returns the row itself by its index, is used to read and write the rest of its data
+FSettingsPicker& FSettingsRowStore::GetRow(int32 RowIndex) const
+{
+	checkf(SourceRows && IsBuiltFor(*SourceRows), TEXT("ERROR: [%i] %hs:\nRows were added or removed since the store was built, it has to be rebuilt first!"), __LINE__, __FUNCTION__);
+
+	FSettingsPicker& Row = *Rows[RowIndex];
+	checkf(Row.PrimaryData.Tag == GetTag(RowIndex), TEXT("ERROR: [%i] %hs:\nRow '%s' doesn't match the store, it has to be rebuilt first!"), __LINE__, __FUNCTION__, *GetTag(RowIndex).ToString());
+	return Row;
+}
+
+// Returns the handle of the row by its tag name, is empty if not found
+FSettingHandle FSettingsRowStore::MakeHandle(FName TagName) const
+{
+	const int32 RowIndex = FindIndex(TagName);
+	return RowIndex != INDEX_NONE ? FSettingHandle(RowIndex, Generation) : FSettingHandle::EmptyHandle;
+}
+
+// Returns indices of rows whose tags match any of specified tags, sorted by rows order
+void FSettingsRowStore::FindIndicesByTags(const FGameplayTagContainer& InTags, TArray<int32>& OutRowIndices) const
+{
+	if (Index)
+	{
+		Index->FindIndicesByTags(InTags, /*Out*/ OutRowIndices);
+	}
+	else
+	{
+		OutRowIndices.Reset();
+	}
+}
+
+// Returns bytes allocated by per-player arrays of this store, the shared index is not included
+SIZE_T FSettingsRowStore::GetAllocatedSize() const
+{
+	return Widgets.GetAllocatedSize() + Rows.GetAllocatedSize();
+}
@@ -0,0 +1,84 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsSharedCatalog.h"
+//---
+#include "Data/SettingsDataTable.h"
+#include "Data/SettingsRowStore.h"
+#include "MyUtilsLibraries/SettingsUtilsLibrary.h"
+
+// Merges specified tables into new catalog, takes the cooked Settings Catalog instead if it's baked from the same tables
+TSharedRef<const FSettingsSharedCatalog> FSettingsSharedCatalog::Build(const TSet<const USettingsDataTable*>& InDataTables)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSettingsSharedCatalog::Build);
+
+	const TSharedRef<FSettingsSharedCatalog> NewCatalog = MakeShared<FSettingsSharedCatalog>();
+
+	NewCatalog->DataTables.Reserve(InDataTables.Num());
+	NewCatalog->DataTableVersions.Reserve(InDataTables.Num());
+	for (const USettingsDataTable* DataTableIt : InDataTables)
+	{
+		NewCatalog->DataTables.Emplace(DataTableIt);
+		NewCatalog->DataTableVersions.Emplace(DataTableIt ? DataTableIt->GetRowsVersion() : 0);
+	}
+
+	// Columns and dependencies of the baked catalog are taken as they are, otherwise they are computed by the index
+	const FSettingsCatalogLayout* PrecomputedLayout = nullptr;
+	if (const USettingsCatalog* SettingsCatalog = USettingsUtilsLibrary::GetUpToDateCatalog(InDataTables))
+	{
+		SettingsCatalog->GetSettingRows(/*Out*/ NewCatalog->Rows);
+		PrecomputedLayout = &SettingsCatalog->GetLayout();
+	}
+	else
+	{
+		USettingsUtilsLibrary::GenerateSettingRows(InDataTables, /*Out*/ NewCatalog->Rows);
+	}
+
+	NewCatalog->Index = FSettingsRowIndex::Make(NewCatalog->Rows, PrecomputedLayout);
+
+	return NewCatalog;
+}
+
+// Returns true if this catalog is merged from exactly specified tables and none of them was changed since then
+bool FSettingsSharedCatalog::IsBuiltFrom(const TSet<const USettingsDataTable*>& InDataTables) const
+{
+	if (DataTables.Num() != InDataTables.Num()
+	    || !IsUpToDate())
+	{
+		return false;
+	}
+
+	for (const TWeakObjectPtr<const USettingsDataTable>& DataTableIt : DataTables)
+	{
+		if (!InDataTables.Contains(DataTableIt.Get()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Returns true if none of tables this catalog is merged from was destroyed or changed since then
+bool FSettingsSharedCatalog::IsUpToDate() const
+{
+	for (int32 TableIndex = 0; TableIndex < DataTables.Num(); ++TableIndex)
+	{
+		const USettingsDataTable* DataTable = DataTables[TableIndex].Get();
+		if (!DataTable
+		    || DataTable->GetRowsVersion() != DataTableVersions[TableIndex])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Returns bytes allocated by all rows and the index of this catalog
+SIZE_T FSettingsSharedCatalog::GetAllocatedSize() const
+{
+	return DataTables.GetAllocatedSize()
+		+ DataTableVersions.GetAllocatedSize()
+		+ Rows.GetAllocatedSize()
+		+ (Index ? Index->GetAllocatedSize() : 0);
+}
@@ -0,0 +1,62 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsSnapshot.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsSnapshot)
+
+// Empty snapshot
+const FSettingsSnapshot FSettingsSnapshot::EmptySnapshot = FSettingsSnapshot();
+
+// Adds the value of specified setting
+void FSettingsSnapshot::Add(const FGameplayTag& Tag, const FString& Value)
+{
+	Tags.Emplace(Tag);
+	Values.Emplace(Value);
+}
+
+// Returns the captured value of specified setting or null if it's not captured
+const FString* FSettingsSnapshot::FindValue(const FGameplayTag& Tag) const
+{
+	const int32 Index = Tags.IndexOfByKey(Tag);
+	return Index != INDEX_NONE && Values.IsValidIndex(Index) ? &Values[Index] : nullptr;
+}
+
+// Returns settings of specified snapshot which values differ from this one or are not captured here
+void FSettingsSnapshot::Diff(const FSettingsSnapshot& Other, FSettingsSnapshot& OutDiff) const
+{
+	OutDiff.Tags.Reset();
+	OutDiff.Values.Reset();
+
+	// Index own values once, so the diff is linear for any snapshot size
+	TMap<FGameplayTag, const FString*> ValuesByTag;
+	const int32 ThisNum = Num();
+	ValuesByTag.Reserve(ThisNum);
+	for (int32 Index = 0; Index < ThisNum; ++Index)
+	{
+		ValuesByTag.Emplace(Tags[Index], &Values[Index]);
+	}
+
+	const int32 OtherNum = Other.Num();
+	for (int32 Index = 0; Index < OtherNum; ++Index)
+	{
+		const FGameplayTag& OtherTag = Other.Tags[Index];
+		const FString& OtherValue = Other.Values[Index];
+		const FString* const* FoundValue = ValuesByTag.Find(OtherTag);
+		if (!FoundValue
+		    || !(*FoundValue)->Equals(OtherValue, ESearchCase::CaseSensitive))
+		{
+			OutDiff.Add(OtherTag, OtherValue);
+		}
+	}
+}
+
+// Returns all captured values by their tags
+void FSettingsSnapshot::ToMap(TMap<FGameplayTag, FString>& OutSettingValues) const
+{
+	const int32 SnapshotNum = Num();
+	OutSettingValues.Empty(SnapshotNum);
+	for (int32 Index = 0; Index < SnapshotNum; ++Index)
+	{
+		OutSettingValues.Emplace(Tags[Index], Values[Index]);
+	}
+}
@@ -0,0 +1,314 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsStyleSet.h"
+//---
+#include "Data/SettingsDataAsset.h"
+//---
+#include "Engine/Texture.h"
+#include "Styling/SlateStyle.h"
+#include "Styling/SlateStyleRegistry.h"
+#include "Styling/StyleDefaults.h"
+
+// The name of registered Slate Style Set
+const FName FSettingsStyleSet::StyleSetName = TEXT("SettingsWidgetConstructorStyle");
+
+namespace SettingsStyleSet
+{
+	/** The single cache instance, is created on first request. */
+	static TUniquePtr<FSettingsStyleSet> Instance = nullptr;
+
+	/** Is true when the cache has to be rebuilt on next request. */
+	static bool bIsDirty = true;
+
+	/** Adds specified widget style to the Slate Style Set, or updates it in place if it was already added, so references to it stay valid. */
+	template <typename TWidgetStyle>
+	static void SetWidgetStyle(FSlateStyleSet& StyleSet, FName StyleName, const TWidgetStyle& WidgetStyle)
+	{
+		if (StyleSet.HasWidgetStyle<TWidgetStyle>(StyleName))
+		{
+			// Is owned by this style set, so can be overwritten
+			const_cast<TWidgetStyle&>(StyleSet.GetWidgetStyle<TWidgetStyle>(StyleName)) = WidgetStyle;
+		}
+		else
+		{
+			StyleSet.Set(StyleName, WidgetStyle);
+		}
+	}
+}
+
+// Returns the cache, builds it if is not built yet or was invalidated
+const FSettingsStyleSet& FSettingsStyleSet::Get()
+{
+	check(IsInGameThread());
+
+	if (!SettingsStyleSet::Instance)
+	{
+		SettingsStyleSet::Instance = MakeUnique<FSettingsStyleSet>();
+	}
+
+	if (SettingsStyleSet::bIsDirty)
+	{
+		SettingsStyleSet::bIsDirty = false;
+		SettingsStyleSet::Instance->Build(USettingsDataAsset::Get());
+	}
+
+	return *SettingsStyleSet::Instance;
+}
+
+// Marks the cache as outdated, so it will be rebuilt in place on next request
+void FSettingsStyleSet::Invalidate()
+{
+	SettingsStyleSet::bIsDirty = true;
+}
+
+// Unregisters the Slate Style Set and releases all brushes, is called on module shutdown
+void FSettingsStyleSet::Shutdown()
+{
+	if (SettingsStyleSet::Instance)
+	{
+		SettingsStyleSet::Instance->Unregister();
+		SettingsStyleSet::Instance.Reset();
+	}
+
+	SettingsStyleSet::bIsDirty = true;
+}
+
+// Returns the cached Slate Style Set that contains all brushes
+const ISlateStyle& FSettingsStyleSet::GetStyle() const
+{
+	checkf(StyleSetInternal, TEXT("ERROR: [%i] %hs:\n'StyleSetInternal' is not built!"), __LINE__, __FUNCTION__);
+	return *StyleSetInternal;
+}
+
+// Returns the cached brush of the button by specified state
+const FSlateBrush& FSettingsStyleSet::GetButtonBrush(ESettingsButtonState State) const
+{
+	const int32 Index = static_cast<int32>(State);
+	return ButtonBrushesInternal.IsValidIndex(Index) ? *ButtonBrushesInternal[Index] : *FStyleDefaults::GetNoBrush();
+}
+
+// Returns the cached brush of the checkbox by specified state
+const FSlateBrush& FSettingsStyleSet::GetCheckboxBrush(ESettingsCheckboxState State) const
+{
+	const int32 Index = static_cast<int32>(State);
+	return CheckboxBrushesInternal.IsValidIndex(Index) ? *CheckboxBrushesInternal[Index] : *FStyleDefaults::GetNoBrush();
+}
+
+// Returns the cached brush of the slider by specified state
+const FSlateBrush& FSettingsStyleSet::GetSliderBrush(ESettingsSliderState State) const
+{
+	const int32 Index = static_cast<int32>(State);
+	return SliderBrushesInternal.IsValidIndex(Index) ? *SliderBrushesInternal[Index] : *FStyleDefaults::GetNoBrush();
+}
+
+// Returns the cached brush of the combobox by specified state
+const FSlateBrush& FSettingsStyleSet::GetComboboxBrush(ESettingsButtonState State) const
+{
+	const int32 Index = static_cast<int32>(State);
+	return ComboboxBrushesInternal.IsValidIndex(Index) ? *ComboboxBrushesInternal[Index] : *FStyleDefaults::GetNoBrush();
+}
+
+// Returns the cached brush by specified name
+const FSlateBrush* FSettingsStyleSet::GetBrush(FName BrushName) const
+{
+	return StyleSetInternal ? StyleSetInternal->GetOptionalBrush(BrushName, nullptr, nullptr) : nullptr;
+}
+
+// Builds all brushes from the theme data of specified Settings Data Asset, registers the Slate Style Set once it's created
+void FSettingsStyleSet::Build(const USettingsDataAsset& SettingsDataAsset)
+{
+	// Is kept on rebuild, so brushes found by name before are still valid
+	const bool bIsNewStyleSet = !StyleSetInternal;
+	if (bIsNewStyleSet)
+	{
+		StyleSetInternal = MakeShared<FSlateStyleSet>(StyleSetName);
+	}
+
+	ButtonBrushesInternal.Reset();
+	CheckboxBrushesInternal.Reset();
+	SliderBrushesInternal.Reset();
+	ComboboxBrushesInternal.Reset();
+
+	const FMiscThemeData& MiscThemeData = SettingsDataAsset.GetMiscThemeData();
+
+	// Normal, Hovered, Pressed and Disabled states
+	const FSlateColor StateColors[] = {MiscThemeData.ThemeColorNormal, MiscThemeData.ThemeColorHover, MiscThemeData.ThemeColorExtra, FLinearColor::White};
+	static const FName StateNames[] = {TEXT("Normal"), TEXT("Hovered"), TEXT("Pressed"), TEXT("Disabled")};
+
+	// Button
+	const FButtonThemeData& ButtonThemeData = SettingsDataAsset.GetButtonThemeData();
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(StateNames); ++Index)
+	{
+		const FName BrushName = *FString::Printf(TEXT("Button.%s"), *StateNames[Index].ToString());
+		ButtonBrushesInternal.Emplace(AddBrush(BrushName, ButtonThemeData, StateColors[Index], ButtonThemeData.Texture));
+	}
+
+	// Combobox
+	const FComboboxThemeData& ComboboxThemeData = SettingsDataAsset.GetComboboxThemeData();
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(StateNames); ++Index)
+	{
+		const FName BrushName = *FString::Printf(TEXT("Combobox.%s"), *StateNames[Index].ToString());
+		ComboboxBrushesInternal.Emplace(AddBrush(BrushName, ComboboxThemeData, StateColors[Index], ComboboxThemeData.Texture));
+	}
+	AddBrush(TEXT("Combobox.Arrow"), ComboboxThemeData.Arrow, MiscThemeData.ThemeColorNormal, ComboboxThemeData.Arrow.Texture);
+	AddBrush(TEXT("Combobox.Border"), ComboboxThemeData.Border, MiscThemeData.ThemeColorNormal, ComboboxThemeData.Border.Texture);
+	AddBrush(TEXT("Combobox.ItemBackground"), ComboboxThemeData, ComboboxThemeData.ItemBackgroundColor, nullptr);
+
+	// Checkbox, is ordered the same as ESettingsCheckboxState: Unchecked, Checked and Undetermined, each with Normal, Hovered and Pressed
+	const FCheckboxThemeData& CheckboxThemeData = SettingsDataAsset.GetCheckboxThemeData();
+	UTexture* const CheckboxTextures[] = {CheckboxThemeData.Texture, CheckboxThemeData.CheckedTexture, CheckboxThemeData.UndeterminedTexture};
+	static const FName CheckboxNames[] = {TEXT("Unchecked"), TEXT("Checked"), TEXT("Undetermined")};
+	for (int32 TextureIndex = 0; TextureIndex < UE_ARRAY_COUNT(CheckboxTextures); ++TextureIndex)
+	{
+		constexpr int32 CheckboxStatesNum = 3;
+		for (int32 StateIndex = 0; StateIndex < CheckboxStatesNum; ++StateIndex)
+		{
+			const FName BrushName = *FString::Printf(TEXT("Checkbox.%s%s"), *CheckboxNames[TextureIndex].ToString(), *StateNames[StateIndex].ToString());
+			CheckboxBrushesInternal.Emplace(AddBrush(BrushName, CheckboxThemeData, StateColors[StateIndex], CheckboxTextures[TextureIndex]));
+		}
+	}
+
+	// Slider, is ordered the same as ESettingsSliderState
+	const FSliderThemeData& SliderThemeData = SettingsDataAsset.GetSliderThemeData();
+	SliderBrushesInternal.Emplace(AddBrush(TEXT("Slider.NormalBar"), SliderThemeData, MiscThemeData.ThemeColorNormal, SliderThemeData.Texture));
+	SliderBrushesInternal.Emplace(AddBrush(TEXT("Slider.HoveredBar"), SliderThemeData, MiscThemeData.ThemeColorHover, SliderThemeData.Texture));
+	SliderBrushesInternal.Emplace(AddBrush(TEXT("Slider.NormalThumb"), SliderThemeData.Thumb, MiscThemeData.ThemeColorNormal, SliderThemeData.Thumb.Texture));
+	SliderBrushesInternal.Emplace(AddBrush(TEXT("Slider.HoveredThumb"), SliderThemeData.Thumb, MiscThemeData.ThemeColorHover, SliderThemeData.Thumb.Texture));
+
+	// User Input
+	const FSettingsThemeData& UserInputThemeData = SettingsDataAsset.GetUserInputThemeData();
+	AddBrush(TEXT("UserInput.Normal"), UserInputThemeData, MiscThemeData.ThemeColorNormal, UserInputThemeData.Texture);
+	AddBrush(TEXT("UserInput.Hovered"), UserInputThemeData, MiscThemeData.ThemeColorHover, UserInputThemeData.Texture);
+
+	// Misc
+	AddBrush(TEXT("Misc.TooltipBackground"), MiscThemeData.TooltipBackground, MiscThemeData.TooltipBackgroundTint, MiscThemeData.TooltipBackground.Texture);
+	AddBrush(TEXT("Misc.WindowBackground"), MiscThemeData.WindowBackground, MiscThemeData.WindowBackgroundTint, MiscThemeData.WindowBackground.Texture);
+	AddBrush(TEXT("Misc.MenuBorder"), MiscThemeData.MenuBorderData, MiscThemeData.MenuBorderTint, MiscThemeData.MenuBorderData.Texture);
+
+	BuildWidgetStyles(SettingsDataAsset);
+
+	if (bIsNewStyleSet)
+	{
+		FSlateStyleRegistry::RegisterSlateStyle(*StyleSetInternal);
+	}
+}
+
+// Builds widget styles of native Slate rows from already cached brushes
+void FSettingsStyleSet::BuildWidgetStyles(const USettingsDataAsset& SettingsDataAsset)
+{
+	const FMiscThemeData& MiscThemeData = SettingsDataAsset.GetMiscThemeData();
+
+	CaptionTextStyleInternal = FTextBlockStyle()
+		.SetFont(MiscThemeData.TextAndCaptionFont)
+		.SetColorAndOpacity(MiscThemeData.TextAndCaptionColor);
+
+	ElementTextStyleInternal = FTextBlockStyle()
+		.SetFont(MiscThemeData.TextElementFont)
+		.SetColorAndOpacity(MiscThemeData.TextElementColor);
+
+	const FButtonThemeData& ButtonThemeData = SettingsDataAsset.GetButtonThemeData();
+	ButtonStyleInternal = FButtonStyle()
+		.SetNormal(GetButtonBrush(ESettingsButtonState::Normal))
+		.SetHovered(GetButtonBrush(ESettingsButtonState::Hovered))
+		.SetPressed(GetButtonBrush(ESettingsButtonState::Pressed))
+		.SetDisabled(GetButtonBrush(ESettingsButtonState::Disabled))
+		.SetNormalPadding(ButtonThemeData.Padding)
+		.SetPressedPadding(ButtonThemeData.PressedPadding);
+
+	CheckboxStyleInternal = FCheckBoxStyle()
+		.SetUncheckedImage(GetCheckboxBrush(ESettingsCheckboxState::UncheckedNormal))
+		.SetUncheckedHoveredImage(GetCheckboxBrush(ESettingsCheckboxState::UncheckedHovered))
+		.SetUncheckedPressedImage(GetCheckboxBrush(ESettingsCheckboxState::UncheckedPressed))
+		.SetCheckedImage(GetCheckboxBrush(ESettingsCheckboxState::CheckedNormal))
+		.SetCheckedHoveredImage(GetCheckboxBrush(ESettingsCheckboxState::CheckedHovered))
+		.SetCheckedPressedImage(GetCheckboxBrush(ESettingsCheckboxState::CheckedPressed))
+		.SetUndeterminedImage(GetCheckboxBrush(ESettingsCheckboxState::UndeterminedNormal))
+		.SetUndeterminedHoveredImage(GetCheckboxBrush(ESettingsCheckboxState::UndeterminedHovered))
+		.SetUndeterminedPressedImage(GetCheckboxBrush(ESettingsCheckboxState::UndeterminedPressed))
+		.SetPadding(SettingsDataAsset.GetCheckboxThemeData().Padding);
+
+	const FComboboxThemeData& ComboboxThemeData = SettingsDataAsset.GetComboboxThemeData();
+	const FButtonStyle ComboboxButtonStyle = FButtonStyle()
+		.SetNormal(GetComboboxBrush(ESettingsButtonState::Normal))
+		.SetHovered(GetComboboxBrush(ESettingsButtonState::Hovered))
+		.SetPressed(GetComboboxBrush(ESettingsButtonState::Pressed))
+		.SetDisabled(GetComboboxBrush(ESettingsButtonState::Disabled))
+		.SetNormalPadding(ComboboxThemeData.Padding)
+		.SetPressedPadding(ComboboxThemeData.PressedPadding);
+	const FSlateBrush* ArrowBrush = GetBrush(TEXT("Combobox.Arrow"));
+	const FSlateBrush* BorderBrush = GetBrush(TEXT("Combobox.Border"));
+	ComboboxStyleInternal = FComboBoxStyle()
+		.SetComboButtonStyle(FComboButtonStyle()
+			.SetButtonStyle(ComboboxButtonStyle)
+			.SetDownArrowImage(ArrowBrush ? *ArrowBrush : *FStyleDefaults::GetNoBrush())
+			.SetMenuBorderBrush(BorderBrush ? *BorderBrush : *FStyleDefaults::GetNoBrush()));
+
+	SliderStyleInternal = FSliderStyle()
+		.SetNormalBarImage(GetSliderBrush(ESettingsSliderState::NormalBar))
+		.SetHoveredBarImage(GetSliderBrush(ESettingsSliderState::HoveredBar))
+		.SetDisabledBarImage(GetSliderBrush(ESettingsSliderState::NormalBar))
+		.SetNormalThumbImage(GetSliderBrush(ESettingsSliderState::NormalThumb))
+		.SetHoveredThumbImage(GetSliderBrush(ESettingsSliderState::HoveredThumb))
+		.SetDisabledThumbImage(GetSliderBrush(ESettingsSliderState::NormalThumb));
+
+	const FSlateBrush* UserInputNormalBrush = GetBrush(TEXT("UserInput.Normal"));
+	const FSlateBrush* UserInputHoveredBrush = GetBrush(TEXT("UserInput.Hovered"));
+	UserInputStyleInternal = FEditableTextBoxStyle()
+		.SetBackgroundImageNormal(UserInputNormalBrush ? *UserInputNormalBrush : *FStyleDefaults::GetNoBrush())
+		.SetBackgroundImageHovered(UserInputHoveredBrush ? *UserInputHoveredBrush : *FStyleDefaults::GetNoBrush())
+		.SetBackgroundImageFocused(UserInputHoveredBrush ? *UserInputHoveredBrush : *FStyleDefaults::GetNoBrush())
+		.SetBackgroundImageReadOnly(UserInputNormalBrush ? *UserInputNormalBrush : *FStyleDefaults::GetNoBrush())
+		.SetTextStyle(ElementTextStyleInternal)
+		.SetPadding(SettingsDataAsset.GetUserInputThemeData().Padding);
+
+	// Register styles as well, so they can be found by name like brushes
+	FSlateStyleSet& StyleSet = *StyleSetInternal;
+	SettingsStyleSet::SetWidgetStyle(StyleSet, TEXT("Text.Caption"), CaptionTextStyleInternal);
+	SettingsStyleSet::SetWidgetStyle(StyleSet, TEXT("Text.Element"), ElementTextStyleInternal);
+	SettingsStyleSet::SetWidgetStyle(StyleSet, TEXT("Button"), ButtonStyleInternal);
+	SettingsStyleSet::SetWidgetStyle(StyleSet, TEXT("Checkbox"), CheckboxStyleInternal);
+	SettingsStyleSet::SetWidgetStyle(StyleSet, TEXT("Combobox"), ComboboxStyleInternal);
+	SettingsStyleSet::SetWidgetStyle(StyleSet, TEXT("Slider"), SliderStyleInternal);
+	SettingsStyleSet::SetWidgetStyle(StyleSet, TEXT("UserInput"), UserInputStyleInternal);
+}
+
+// Unregisters the Slate Style Set if was registered
+void FSettingsStyleSet::Unregister()
+{
+	if (StyleSetInternal)
+	{
+		FSlateStyleRegistry::UnRegisterSlateStyle(*StyleSetInternal);
+		StyleSetInternal.Reset();
+	}
+
+	BrushesByNameInternal.Reset();
+	ButtonBrushesInternal.Reset();
+	CheckboxBrushesInternal.Reset();
+	SliderBrushesInternal.Reset();
+	ComboboxBrushesInternal.Reset();
+}
+
+// Creates new brush by specified theme data and adds it to the Slate Style Set, or updates the brush in place if it was already added
+const FSlateBrush* FSettingsStyleSet::AddBrush(FName BrushName, const FSettingsThemeData& ThemeData, const FSlateColor& TintColor, UTexture* Texture)
+{
+	checkf(StyleSetInternal, TEXT("ERROR: [%i] %hs:\n'StyleSetInternal' is null!"), __LINE__, __FUNCTION__);
+
+	FSlateBrush NewBrush;
+	NewBrush.TintColor = TintColor;
+	NewBrush.DrawAs = ThemeData.DrawAs;
+	NewBrush.Margin = ThemeData.Margin;
+	NewBrush.SetImageSize(ThemeData.Size);
+	NewBrush.SetResourceObject(Texture);
+
+	if (FSlateBrush* const* FoundBrush = BrushesByNameInternal.Find(BrushName))
+	{
+		**FoundBrush = NewBrush;
+		return *FoundBrush;
+	}
+
+	// Is owned and released by the Slate Style Set
+	FSlateBrush* SlateBrush = new FSlateBrush(NewBrush);
+	StyleSetInternal->Set(BrushName, SlateBrush);
+	BrushesByNameInternal.Emplace(BrushName, SlateBrush);
+	return SlateBrush;
+}
@@ -0,0 +1,88 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsTextCache.h"
+//---
+#include "Internationalization/Culture.h"
+#include "Internationalization/Internationalization.h"
+#include "Internationalization/TextKey.h"
+
+namespace SettingsTextCache
+{
+	/** The single cache instance, is created on first request. */
+	static TUniquePtr<FSettingsTextCache> Instance = nullptr;
+
+	/** Is set once the module is shut down, so the cache is not created again, e.g: by widgets destroyed after the module. */
+	static bool bIsShutdown = false;
+
+	/** Returns the name of the current language, display strings depend on it. */
+	static FString GetCurrentCultureName()
+	{
+		return FInternationalization::IsAvailable() ? FInternationalization::Get().GetCurrentLanguage()->GetName() : FString();
+	}
+}
+
+// Returns the cache, is created on first request, is null once the module is shut down
+FSettingsTextCache* FSettingsTextCache::Get()
+{
+	check(IsInGameThread());
+
+	if (SettingsTextCache::bIsShutdown)
+	{
+		return nullptr;
+	}
+
+	if (!SettingsTextCache::Instance)
+	{
+		SettingsTextCache::Instance = MakeUnique<FSettingsTextCache>();
+	}
+
+	return SettingsTextCache::Instance.Get();
+}
+
+// Stops listening to the culture change, is called on module shutdown, the cache is never created again
+void FSettingsTextCache::Shutdown()
+{
+	SettingsTextCache::bIsShutdown = true;
+	SettingsTextCache::Instance.Reset();
+}
+
+// Returns the ID of specified text that is the same for all cultures
+FString FSettingsTextCache::MakeTextId(const FText& Text)
+{
+	const FTextId TextId = FTextInspector::GetTextId(Text);
+	return TextId.IsEmpty() ? Text.ToString() : TextId.GetKey().ToString();
+}
+
+// Default constructor, starts listening to the culture change
+FSettingsTextCache::FSettingsTextCache()
+{
+	CurrentCulture = SettingsTextCache::GetCurrentCultureName();
+
+	if (FInternationalization::IsAvailable())
+	{
+		FInternationalization::Get().OnCultureChanged().AddRaw(this, &FSettingsTextCache::HandleCultureChanged);
+	}
+}
+
+// Destructor, stops listening to the culture change
+FSettingsTextCache::~FSettingsTextCache()
+{
+	if (FInternationalization::IsAvailable())
+	{
+		FInternationalization::Get().OnCultureChanged().RemoveAll(this);
+	}
+}
+
+// Is called by the engine after the culture is changed
+void FSettingsTextCache::HandleCultureChanged()
+{
+	const FString NewCulture = SettingsTextCache::GetCurrentCultureName();
+	if (NewCulture == CurrentCulture)
+	{
+		return;
+	}
+
+	CurrentCulture = NewCulture;
+
+	OnCultureChangedDelegate.Broadcast();
+}
@@ -2,25 +2,74 @@
 
 #include "MyUtilsLibraries/SettingsUtilsLibrary.h"
 //---
-#include "MyUtilsLibraries/SWCWidgetUtilsLibrary.h"
+#include "SettingsWidgetConstructorStats.h"
 #include "GameFramework/GameUserSettings.h"
 #include "UI/SettingsWidget.h"
+#include "Data/SettingsCatalog.h"
 #include "Data/SettingsDataAsset.h"
 #include "Data/SettingsDataTable.h"
 #include "Data/SettingsRow.h"
+#include "Data/SettingsSnapshot.h"
+#include "Subsystems/SettingsWidgetSubsystem.h"
 //---
 #include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
 #include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Slate/SRetainerWidget.h"
+#include "Widgets/SInvalidationPanel.h"
 #include "DataRegistrySource_DataTable.h"
 #include "DataRegistrySubsystem.h"
+#include "Async/ParallelFor.h"
 //---
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsUtilsLibrary)
 
 // Returns the Settings widget from viewport
 USettingsWidget* USettingsUtilsLibrary::GetSettingsWidget(const UObject* WorldContextObject)
 {
-	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
-	return FSWCWidgetUtilsLibrary::FindWidgetOfClass<USettingsWidget>(World);
+	const USettingsWidgetSubsystem* SettingsWidgetSubsystem = USettingsWidgetSubsystem::Get(WorldContextObject);
+	return SettingsWidgetSubsystem ? SettingsWidgetSubsystem->GetSettingsWidget() : nullptr;
+}
+
+// Returns the Settings widget of specified local player
+USettingsWidget* USettingsUtilsLibrary::GetSettingsWidgetByPlayer(const APlayerController* PlayerController)
+{
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	const USettingsWidgetSubsystem* SettingsWidgetSubsystem = LocalPlayer ? LocalPlayer->GetSubsystem<USettingsWidgetSubsystem>() : nullptr;
+	return SettingsWidgetSubsystem ? SettingsWidgetSubsystem->GetSettingsWidget() : nullptr;
+}
+
+// Returns the Settings widget of the local player by its index in the game instance
+USettingsWidget* USettingsUtilsLibrary::GetSettingsWidgetByPlayerIndex(const UObject* WorldContextObject, int32 LocalPlayerIndex)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	const ULocalPlayer* LocalPlayer = GameInstance ? GameInstance->GetLocalPlayerByIndex(LocalPlayerIndex) : nullptr;
+	const USettingsWidgetSubsystem* SettingsWidgetSubsystem = LocalPlayer ? LocalPlayer->GetSubsystem<USettingsWidgetSubsystem>() : nullptr;
+	return SettingsWidgetSubsystem ? SettingsWidgetSubsystem->GetSettingsWidget() : nullptr;
+}
+
+// Returns constructed Settings widgets of all local players
+void USettingsUtilsLibrary::GetAllSettingsWidgets(const UObject* WorldContextObject, TArray<USettingsWidget*>& OutSettingsWidgets)
+{
+	OutSettingsWidgets.Reset();
+
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	if (!GameInstance)
+	{
+		return;
+	}
+
+	for (const ULocalPlayer* LocalPlayerIt : GameInstance->GetLocalPlayers())
+	{
+		const USettingsWidgetSubsystem* SettingsWidgetSubsystem = LocalPlayerIt ? LocalPlayerIt->GetSubsystem<USettingsWidgetSubsystem>() : nullptr;
+		if (USettingsWidget* SettingsWidget = SettingsWidgetSubsystem ? SettingsWidgetSubsystem->GetSettingsWidget() : nullptr)
+		{
+			OutSettingsWidgets.Emplace(SettingsWidget);
+		}
+	}
 }
 
 // Returns the Game User Settings object
@@ -32,50 +81,73 @@ UGameUserSettings* USettingsUtilsLibrary::GetGameUserSettings(const UObject* Opt
 // Returns all Settings Rows from project's Settings Data Table and all other additional Data Tables from 'SettingsDataTable' Data Registry
 void USettingsUtilsLibrary::GenerateAllSettingRows(TMap<FName, FSettingsPicker>& OutSettingRows)
 {
-	if (!OutSettingRows.IsEmpty())
-	{
-		OutSettingRows.Empty();
-	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsUtilsLibrary::GenerateAllSettingRows);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_GenerateAllSettingRows);
 
 	TSet<const USettingsDataTable*> OutDataTables;
 	GetAllSettingDataTables(OutDataTables);
 
 	if (!ensureMsgf(!OutDataTables.IsEmpty(), TEXT("ASSERT: [%i] %s:\n'Settings Data Table' is not set in the 'Project Settings', can't retrieve any settings!"), __LINE__, *FString(__FUNCTION__)))
 	{
+		OutSettingRows.Empty();
 		return;
 	}
 
+	if (const USettingsCatalog* SettingsCatalog = GetUpToDateCatalog(OutDataTables))
+	{
+		SettingsCatalog->GetSettingRows(OutSettingRows);
+		return;
+	}
+
+	GenerateSettingRows(OutDataTables, OutSettingRows);
+}
+
+// Returns all Settings Rows from specified Settings Data Tables sorted by FSettingsPrimary::ShowNextToSettingOverride
+void USettingsUtilsLibrary::GenerateSettingRows(const TSet<const USettingsDataTable*>& DataTables, TMap<FName, FSettingsPicker>& OutSettingRows)
+{
+	if (!OutSettingRows.IsEmpty())
+	{
+		OutSettingRows.Empty();
+	}
+
 	/**
 	 * Sort Setting Rows based on the FSettingsPrimary::ShowNextToSettingOverride property.
 	 * All the next settings after ShowNextToSettingOverride in the same table will be also shown next to it.
 	 * Sort is needed since setting can be shown based on another setting in different Settings Data Table, so we want to fix the order.
 	 */
 
-	TArray<FSettingsRow> OrderedSettings;
-	TMap<FSettingTag, TArray<FSettingsRow>> OverrideBlocks;
+	// Settings of one table, rows are referenced right in the table instead of copying them
+	struct FTableOrder
+	{
+		TArray<const FSettingsPicker*> OrderedSettings;
+		TArray<TPair<FSettingTag, TArray<const FSettingsPicker*>>> OverrideBlocks;
+	};
+
+	const TArray<const USettingsDataTable*> DataTablesArray = DataTables.Array();
+	TArray<FTableOrder> TableOrders;
+	TableOrders.SetNum(DataTablesArray.Num());
 
-	// Collect settings and override blocks
-	for (const USettingsDataTable* TableIt : OutDataTables)
+	// Prepare: tables don't depend on each other, so settings and override blocks of each table are collected in parallel
+	ParallelFor(DataTablesArray.Num(), [&DataTablesArray, &TableOrders](int32 TableIndex)
 	{
+		const USettingsDataTable* TableIt = DataTablesArray[TableIndex];
 		checkf(TableIt, TEXT("ERROR: [%i] %s:\n'TableIt' is null!"), __LINE__, *FString(__FUNCTION__));
 
-		TMap<FName, FSettingsRow> TableRows;
-		TableIt->GetSettingRows(TableRows);
-
-		TArray<FSettingsRow> CurrentOverrideBlock;
+		FTableOrder& TableOrder = TableOrders[TableIndex];
+		TArray<const FSettingsPicker*> CurrentOverrideBlock;
 		FSettingTag CurrentOverrideTag;
 
-		for (const TTuple<FName, FSettingsRow>& Pair : TableRows)
+		for (const TTuple<FName, uint8*>& Pair : TableIt->GetRowMap())
 		{
-			const FSettingsRow& Row = Pair.Value;
-			const FSettingTag& OverrideTag = Row.SettingsPicker.PrimaryData.ShowNextToSettingOverride;
+			const FSettingsPicker& Setting = reinterpret_cast<const FSettingsRow*>(Pair.Value)->SettingsPicker;
+			const FSettingTag& OverrideTag = Setting.PrimaryData.ShowNextToSettingOverride;
 
 			if (OverrideTag.IsValid())
 			{
 				// Store the previous block if any, then start a new block
 				if (CurrentOverrideBlock.Num() > 0)
 				{
-					OverrideBlocks.Emplace(CurrentOverrideTag, MoveTemp(CurrentOverrideBlock));
+					TableOrder.OverrideBlocks.Emplace(CurrentOverrideTag, MoveTemp(CurrentOverrideBlock));
 				}
 				CurrentOverrideBlock.Empty();
 				CurrentOverrideTag = OverrideTag;
@@ -83,42 +155,97 @@ void USettingsUtilsLibrary::GenerateAllSettingRows(TMap<FName, FSettingsPicker>&
 
 			if (CurrentOverrideTag.IsValid())
 			{
-				CurrentOverrideBlock.Emplace(Row);
+				CurrentOverrideBlock.Emplace(&Setting);
 			}
 			else
 			{
-				OrderedSettings.Emplace(Row);
+				TableOrder.OrderedSettings.Emplace(&Setting);
 			}
 		}
 
 		// Add the last block if any
 		if (CurrentOverrideBlock.Num() > 0)
 		{
-			OverrideBlocks.Emplace(CurrentOverrideTag, MoveTemp(CurrentOverrideBlock));
+			TableOrder.OverrideBlocks.Emplace(CurrentOverrideTag, MoveTemp(CurrentOverrideBlock));
+		}
+	});
+
+	// Commit: tables are merged in their order, so the block of the later table replaces the same block of previous ones
+	int32 SettingsNum = 0;
+	TArray<const FSettingsPicker*> OrderedSettings;
+	TMap<FSettingTag, TArray<const FSettingsPicker*>> OverrideBlocks;
+	for (FTableOrder& TableOrderIt : TableOrders)
+	{
+		OrderedSettings.Append(TableOrderIt.OrderedSettings);
+		SettingsNum += TableOrderIt.OrderedSettings.Num();
+		for (TPair<FSettingTag, TArray<const FSettingsPicker*>>& BlockIt : TableOrderIt.OverrideBlocks)
+		{
+			SettingsNum += BlockIt.Value.Num();
+			OverrideBlocks.Emplace(BlockIt.Key, MoveTemp(BlockIt.Value));
 		}
 	}
 
 	// Build the final map, handling the override blocks
-	for (const FSettingsRow& Row : OrderedSettings)
+	OutSettingRows.Reserve(SettingsNum);
+	for (const FSettingsPicker* Setting : OrderedSettings)
 	{
-		const FName Tag = Row.SettingsPicker.PrimaryData.Tag.GetTagName();
-		OutSettingRows.Add(Tag, Row.SettingsPicker);
+		const FSettingTag& SettingTag = Setting->PrimaryData.Tag;
+		OutSettingRows.Add(SettingTag.GetTagName(), *Setting);
 
 		// Check if there's an override block for this tag
-		const FSettingTag SettingTag = Row.SettingsPicker.PrimaryData.Tag;
-		TArray<FSettingsRow>* OverrideBlock = OverrideBlocks.Find(SettingTag);
-		if (OverrideBlock)
+		if (const TArray<const FSettingsPicker*>* OverrideBlock = OverrideBlocks.Find(SettingTag))
 		{
 			// Add the override block next to the current setting
-			for (const FSettingsRow& OverrideRow : *OverrideBlock)
+			for (const FSettingsPicker* OverrideSetting : *OverrideBlock)
 			{
-				const FName OverrideTag = OverrideRow.SettingsPicker.PrimaryData.Tag.GetTagName();
-				OutSettingRows.Add(OverrideTag, OverrideRow.SettingsPicker);
+				OutSettingRows.Add(OverrideSetting->PrimaryData.Tag.GetTagName(), *OverrideSetting);
 			}
 		}
 	}
 }
 
+// Returns the Settings Catalog if it's baked from exactly specified tables, otherwise null
+const USettingsCatalog* USettingsUtilsLibrary::GetUpToDateCatalog(const TSet<const USettingsDataTable*>& DataTables)
+{
+	const USettingsCatalog* SettingsCatalog = USettingsDataAsset::Get().GetSettingsCatalog();
+	return SettingsCatalog && SettingsCatalog->IsUpToDate(DataTables) ? SettingsCatalog : nullptr;
+}
+
+// Returns settings of the second snapshot which values differ from the first one
+void USettingsUtilsLibrary::DiffSettingsSnapshots(const FSettingsSnapshot& From, const FSettingsSnapshot& To, FSettingsSnapshot& OutDiff)
+{
+	From.Diff(To, OutDiff);
+}
+
+// Returns specified Slate content wrapped into the invalidation or retainer panel, or the content itself if the mode is 'None'
+TSharedRef<SWidget> USettingsUtilsLibrary::WrapInvalidationRoot(const TSharedRef<SWidget>& Content, ESettingsInvalidationMode InvalidationMode, FName DebugName)
+{
+	switch (InvalidationMode)
+	{
+		case ESettingsInvalidationMode::InvalidationPanel:
+			return SNew(SInvalidationPanel)
+				.DebugName(DebugName.ToString())
+				[
+					Content
+				];
+		case ESettingsInvalidationMode::RetainerPanel:
+		{
+			// Render only when anything inside is invalidated, not on every phase
+			const TSharedRef<SRetainerWidget> RetainerWidget = SNew(SRetainerWidget)
+				.StatId(DebugName)
+				.RenderOnInvalidation(true)
+				.RenderOnPhase(false)
+				[
+					Content
+				];
+			RetainerWidget->SetRetainedRendering(true);
+			return RetainerWidget;
+		}
+		default:
+			return Content;
+	}
+}
+
 /*********************************************************************************************
  * Multiple Data Tables support
  ********************************************************************************************* */
@@ -151,6 +278,9 @@ void USettingsUtilsLibrary::RegisterDataTable(const TSoftObjectPtr<const USettin
 // Returns all Settings Data Tables added to 'SettingsDataTable' Data Registry
 void USettingsUtilsLibrary::GetAllSettingDataTables(TSet<const USettingsDataTable*>& OutDataTables)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsUtilsLibrary::GetAllSettingDataTables);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_GetAllSettingDataTables);
+
 	if (!OutDataTables.IsEmpty())
 	{
 		OutDataTables.Empty();
@@ -0,0 +1,532 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Profiling/SettingsBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "SettingsWidgetConstructorModule.h"
+#include "Data/SettingsDataTable.h"
+#include "Data/SettingsEngine.h"
+#include "Data/SettingsRow.h"
+#include "MyUtilsLibraries/SettingsUtilsLibrary.h"
+#include "Profiling/SettingsBenchmarkOwner.h"
+#include "Subsystems/SettingsWidgetSubsystem.h"
+#include "UI/SettingsWidget.h"
+//---
+#include "GameplayTagsManager.h"
+#include "NativeGameplayTags.h"
+#include "Blueprint/UserWidget.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Input/HittestGrid.h"
+#include "Rendering/DrawElements.h"
+#include "Types/PaintArgs.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectGlobals.h"
+
+const TCHAR* FSettingsBenchmark::ConsoleCommandName = TEXT("SettingsWidgetConstructor.Benchmark");
+
+namespace SettingsBenchmark
+{
+	/** Amount of rows after which the next generated row starts on new column. */
+	constexpr int32 RowsPerColumn = 50;
+
+	/** Generated setting tags, each is removed from the gameplay tags manager once destroyed. */
+	static TArray<TUniquePtr<FNativeGameplayTag>> NativeTags;
+
+	/** Returns the directory where all benchmark files are written. */
+	static FString GetOutputDir()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SettingsWidgetConstructor") / TEXT("Benchmark");
+	}
+
+	/** Returns the full name of generated setting tag by its row index. */
+	static FString GetTagString(int32 RowIndex)
+	{
+		return FString::Printf(TEXT("Settings.Benchmark.Row%d"), RowIndex);
+	}
+
+	/** Measures the body for given amount of iterations, where setup is called before each iteration and is not measured. */
+	template <typename TSetup, typename TBody>
+	static FSettingsBenchmarkResult Measure(const TCHAR* CaseName, int32 RowsNum, const FSettingsBenchmarkParams& Params, TSetup&& Setup, TBody&& Body)
+	{
+		FSettingsBenchmarkResult Result;
+		Result.CaseName = CaseName;
+		Result.RowsNum = RowsNum;
+		Result.FanOut = Params.FanOut;
+		Result.Iterations = FMath::Max(Params.Iterations, 1);
+		Result.MinMs = TNumericLimits<double>::Max();
+
+		double TotalMs = 0.0;
+		for (int32 Index = 0; Index < Result.Iterations; ++Index)
+		{
+			Setup();
+
+			const double StartTime = FPlatformTime::Seconds();
+			Body();
+			const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			TotalMs += ElapsedMs;
+			Result.MinMs = FMath::Min(Result.MinMs, ElapsedMs);
+			Result.MaxMs = FMath::Max(Result.MaxMs, ElapsedMs);
+		}
+
+		Result.AvgMs = TotalMs / Result.Iterations;
+
+		UE_LOG(LogSettingsWidgetConstructor, Log, TEXT("Benchmark: %s, Rows: %d, FanOut: %d, Avg: %.3f ms, Min: %.3f ms, Max: %.3f ms"),
+		       *Result.CaseName, Result.RowsNum, Result.FanOut, Result.AvgMs, Result.MinMs, Result.MaxMs);
+
+		return Result;
+	}
+
+	/** Is used as setup of cases that don't require any preparation. */
+	static void NoSetup() {}
+
+	/** Size of the offscreen geometry the settings are painted on. */
+	static const FVector2D PaintSize(1920.0, 1080.0);
+
+	/** Prepasses and paints specified widget offscreen, the same way the game viewport would do it once per frame. */
+	static void PaintWidget(const TSharedRef<SWidget>& Widget)
+	{
+		Widget->SlatePrepass(1.f);
+
+		FHittestGrid HittestGrid;
+		FSlateWindowElementList ElementList(nullptr);
+		const FGeometry Geometry = FGeometry::MakeRoot(PaintSize, FSlateLayoutTransform());
+		const FPaintArgs PaintArgs(nullptr, HittestGrid, FVector2D::ZeroVector, FSlateApplication::Get().GetCurrentTime(), FSlateApplication::Get().GetDeltaTime());
+		Widget->Paint(PaintArgs, Geometry, FSlateRect(FVector2D::ZeroVector, PaintSize), ElementList, 0, FWidgetStyle(), /*bParentEnabled*/true);
+	}
+
+	/** Runs the settings benchmark, e.g: SettingsWidgetConstructor.Benchmark Rows=10,100 FanOut=4 Iterations=5 -NoWidget -Quit */
+	static FAutoConsoleCommandWithWorldAndArgs BenchmarkCommand(
+		FSettingsBenchmark::ConsoleCommandName,
+		TEXT("Measures settings construction and propagation on generated Settings Data Tables, writes CSV and JSON reports to 'Saved/SettingsWidgetConstructor/Benchmark'.\n")
+		TEXT("Args: Rows=10,100,1000,5000 FanOut=4 Iterations=5 WidgetClass=/Path/To.Widget_C -NoWidget -Quit"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&FSettingsBenchmark::OnConsoleCommand));
+}
+
+// Parses params from console arguments like: Rows=10,100 FanOut=4 Iterations=5 -NoWidget -Quit WidgetClass=/Game/...
+FSettingsBenchmarkParams FSettingsBenchmarkParams::FromString(const FString& Args)
+{
+	FSettingsBenchmarkParams Params;
+
+	FString RowsString;
+	if (FParse::Value(*Args, TEXT("Rows="), RowsString, /*bShouldStopOnSeparator*/false))
+	{
+		TArray<FString> RowsStrings;
+		RowsString.ParseIntoArray(RowsStrings, TEXT(","));
+
+		Params.RowsNums.Reset();
+		for (const FString& RowsIt : RowsStrings)
+		{
+			const int32 RowsNum = FCString::Atoi(*RowsIt);
+			if (RowsNum > 0)
+			{
+				Params.RowsNums.Emplace(RowsNum);
+			}
+		}
+	}
+
+	FParse::Value(*Args, TEXT("FanOut="), Params.FanOut);
+	Params.FanOut = FMath::Max(Params.FanOut, 0);
+
+	FParse::Value(*Args, TEXT("Iterations="), Params.Iterations);
+	Params.Iterations = FMath::Max(Params.Iterations, 1);
+
+	FString WidgetClassString;
+	if (FParse::Value(*Args, TEXT("WidgetClass="), WidgetClassString))
+	{
+		Params.WidgetClass = FSoftClassPath(WidgetClassString);
+	}
+
+	Params.bMeasureWidget = !FParse::Param(*Args, TEXT("NoWidget"));
+	Params.bQuitOnFinish = FParse::Param(*Args, TEXT("Quit"));
+
+	return Params;
+}
+
+// Runs all benchmark cases with given params, returns false if nothing was measured
+bool FSettingsBenchmark::Run(UWorld* World, const FSettingsBenchmarkParams& Params, TArray<FSettingsBenchmarkResult>& OutResults)
+{
+	OutResults.Reset();
+
+	// Measured widget registers itself once its Slate widget is built, so the widget shown in game is registered back at the end
+	USettingsWidgetSubsystem* SettingsWidgetSubsystem = World ? USettingsWidgetSubsystem::Get(World) : nullptr;
+	const TWeakObjectPtr<USettingsWidget> ShownSettingsWidget = SettingsWidgetSubsystem ? SettingsWidgetSubsystem->GetSettingsWidget() : nullptr;
+
+	// Garbage is collected between iterations, so created objects are kept alive for the whole run
+	const TStrongObjectPtr<USettingsWidget> SettingsWidget(World && Params.bMeasureWidget ? CreateSettingsWidget(*World, Params) : nullptr);
+	if (Params.bMeasureWidget && !SettingsWidget)
+	{
+		UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("Benchmark: Settings Widget can't be created, only data cases will be measured"));
+	}
+
+	TArray<TStrongObjectPtr<USettingsDataTable>> DataTables;
+	DataTables.Reserve(Params.RowsNums.Num());
+
+	for (const int32 RowsNum : Params.RowsNums)
+	{
+		const TStrongObjectPtr<USettingsDataTable>& DataTable = DataTables.Emplace_GetRef(GenerateDataTable(RowsNum, Params.FanOut));
+		if (!DataTable)
+		{
+			continue;
+		}
+
+		RunDataCases(*DataTable, RowsNum, Params, OutResults);
+
+		if (SettingsWidget)
+		{
+			RunWidgetCases(*SettingsWidget, *DataTable, RowsNum, Params, OutResults);
+		}
+	}
+
+	// Generated rows are not used anymore, so their tags can be removed
+	DataTables.Empty();
+	UnregisterBenchmarkTags();
+
+	if (SettingsWidgetSubsystem
+	    && ShownSettingsWidget.IsValid())
+	{
+		SettingsWidgetSubsystem->RegisterSettingsWidget(ShownSettingsWidget.Get());
+	}
+
+	return !OutResults.IsEmpty();
+}
+
+// Creates transient Settings Data Table with specified amount of rows, where archetypes are alternated
+USettingsDataTable* FSettingsBenchmark::GenerateDataTable(int32 RowsNum, int32 FanOut)
+{
+	if (!ensureMsgf(RowsNum > 0, TEXT("ASSERT: [%i] %hs:\n'RowsNum' has to be positive, but it is %d!"), __LINE__, __FUNCTION__, RowsNum)
+	    || !RegisterBenchmarkTags(RowsNum))
+	{
+		return nullptr;
+	}
+
+	USettingsDataTable* DataTable = NewObject<USettingsDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	// Leading rows are always checkboxes to propagate their changes, rest rows alternate all other archetypes
+	static const FName FollowerTypes[] = {
+		GET_MEMBER_NAME_CHECKED(FSettingsPicker, Button),
+		GET_MEMBER_NAME_CHECKED(FSettingsPicker, Combobox),
+		GET_MEMBER_NAME_CHECKED(FSettingsPicker, Slider),
+		GET_MEMBER_NAME_CHECKED(FSettingsPicker, TextLine),
+		GET_MEMBER_NAME_CHECKED(FSettingsPicker, UserInput),
+		GET_MEMBER_NAME_CHECKED(FSettingsPicker, Checkbox)
+	};
+
+	UClass* OwnerClass = USettingsBenchmarkOwner::StaticClass();
+	const FSettingFunctionPicker Owner(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, GetBenchmarkOwner));
+	const int32 GroupSize = FMath::Max(FanOut, 0) + 1;
+
+	for (int32 RowIndex = 0; RowIndex < RowsNum; ++RowIndex)
+	{
+		FSettingsRow Row;
+		FSettingsPicker& Picker = Row.SettingsPicker;
+		FSettingsPrimary& Primary = Picker.PrimaryData;
+
+		Primary.Tag = GetBenchmarkTag(RowIndex);
+		Primary.Owner = Owner;
+		Primary.Caption = FText::FromString(FString::Printf(TEXT("Benchmark %d"), RowIndex));
+		Primary.bStartOnNextColumn = RowIndex > 0 && RowIndex % SettingsBenchmark::RowsPerColumn == 0;
+
+		const bool bIsLeader = RowIndex % GroupSize == 0;
+		if (bIsLeader)
+		{
+			for (int32 FollowerIndex = RowIndex + 1; FollowerIndex < FMath::Min(RowIndex + GroupSize, RowsNum); ++FollowerIndex)
+			{
+				Primary.SettingsToUpdate.AddTag(GetBenchmarkTag(FollowerIndex));
+			}
+		}
+
+		Picker.SettingsType = bIsLeader ? GET_MEMBER_NAME_CHECKED(FSettingsPicker, Checkbox) : FollowerTypes[RowIndex % UE_ARRAY_COUNT(FollowerTypes)];
+
+		if (Picker.SettingsType == GET_MEMBER_NAME_CHECKED(FSettingsPicker, Button))
+		{
+			Primary.Setter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, OnButtonPressed));
+		}
+		else if (Picker.SettingsType == GET_MEMBER_NAME_CHECKED(FSettingsPicker, Checkbox))
+		{
+			Primary.Getter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, GetCheckbox));
+			Primary.Setter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, SetCheckbox));
+		}
+		else if (Picker.SettingsType == GET_MEMBER_NAME_CHECKED(FSettingsPicker, Combobox))
+		{
+			Primary.Getter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, GetComboboxIndex));
+			Primary.Setter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, SetComboboxIndex));
+			Picker.Combobox.GetMembers = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, GetComboboxMembers));
+			Picker.Combobox.SetMembers = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, SetComboboxMembers));
+			Picker.Combobox.Members = {FText::FromString(TEXT("Low")), FText::FromString(TEXT("Medium")), FText::FromString(TEXT("High"))};
+		}
+		else if (Picker.SettingsType == GET_MEMBER_NAME_CHECKED(FSettingsPicker, Slider))
+		{
+			Primary.Getter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, GetSlider));
+			Primary.Setter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, SetSlider));
+		}
+		else if (Picker.SettingsType == GET_MEMBER_NAME_CHECKED(FSettingsPicker, TextLine))
+		{
+			Primary.Getter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, GetTextLine));
+			Primary.Setter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, SetTextLine));
+		}
+		else if (Picker.SettingsType == GET_MEMBER_NAME_CHECKED(FSettingsPicker, UserInput))
+		{
+			Primary.Getter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, GetUserInput));
+			Primary.Setter = FSettingFunctionPicker(OwnerClass, GET_FUNCTION_NAME_CHECKED(USettingsBenchmarkOwner, SetUserInput));
+		}
+
+		DataTable->AddRow(Primary.Tag.GetTagName(), Row);
+	}
+
+	return DataTable;
+}
+
+// Writes CSV and JSON reports, returns the path of written CSV file or empty string on fail
+FString FSettingsBenchmark::WriteReport(const TArray<FSettingsBenchmarkResult>& Results)
+{
+	const FString FileName = FString::Printf(TEXT("SettingsBenchmark_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	const FString CsvPath = SettingsBenchmark::GetOutputDir() / FileName + TEXT(".csv");
+	const FString JsonPath = SettingsBenchmark::GetOutputDir() / FileName + TEXT(".json");
+
+	FString CsvString = TEXT("Case,Rows,FanOut,Iterations,AvgMs,MinMs,MaxMs\n");
+	TArray<TSharedPtr<FJsonValue>> JsonResults;
+	JsonResults.Reserve(Results.Num());
+
+	for (const FSettingsBenchmarkResult& ResultIt : Results)
+	{
+		CsvString += FString::Printf(TEXT("%s,%d,%d,%d,%.4f,%.4f,%.4f\n"),
+		                             *ResultIt.CaseName, ResultIt.RowsNum, ResultIt.FanOut, ResultIt.Iterations, ResultIt.AvgMs, ResultIt.MinMs, ResultIt.MaxMs);
+
+		const TSharedRef<FJsonObject> JsonResult = MakeShared<FJsonObject>();
+		JsonResult->SetStringField(TEXT("case"), ResultIt.CaseName);
+		JsonResult->SetNumberField(TEXT("rows"), ResultIt.RowsNum);
+		JsonResult->SetNumberField(TEXT("fanOut"), ResultIt.FanOut);
+		JsonResult->SetNumberField(TEXT("iterations"), ResultIt.Iterations);
+		JsonResult->SetNumberField(TEXT("avgMs"), ResultIt.AvgMs);
+		JsonResult->SetNumberField(TEXT("minMs"), ResultIt.MinMs);
+		JsonResult->SetNumberField(TEXT("maxMs"), ResultIt.MaxMs);
+		JsonResults.Emplace(MakeShared<FJsonValueObject>(JsonResult));
+	}
+
+	const TSharedRef<FJsonObject> JsonRoot = MakeShared<FJsonObject>();
+	JsonRoot->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	JsonRoot->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	JsonRoot->SetArrayField(TEXT("results"), JsonResults);
+
+	FString JsonString;
+	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(JsonRoot, JsonWriter);
+
+	if (!FFileHelper::SaveStringToFile(CsvString, *CsvPath)
+	    || !FFileHelper::SaveStringToFile(JsonString, *JsonPath))
+	{
+		UE_LOG(LogSettingsWidgetConstructor, Error, TEXT("Benchmark: failed to write the report to '%s'"), *SettingsBenchmark::GetOutputDir());
+		return FString();
+	}
+
+	return CsvPath;
+}
+
+// Returns the setting tag of generated row by its index, is invalid if tags were not registered
+FSettingTag FSettingsBenchmark::GetBenchmarkTag(int32 RowIndex)
+{
+	return FGameplayTag::RequestGameplayTag(*SettingsBenchmark::GetTagString(RowIndex), /*ErrorIfNotFound*/false);
+}
+
+// Is called by the console command to run the benchmark with parsed params and write the report
+void FSettingsBenchmark::OnConsoleCommand(const TArray<FString>& Args, UWorld* World)
+{
+	const FSettingsBenchmarkParams Params = FSettingsBenchmarkParams::FromString(FString::Join(Args, TEXT(" ")));
+
+	TArray<FSettingsBenchmarkResult> Results;
+	if (Run(World, Params, Results))
+	{
+		const FString ReportPath = WriteReport(Results);
+		UE_LOG(LogSettingsWidgetConstructor, Display, TEXT("Benchmark: %d cases are measured, the report is written to '%s'"), Results.Num(), *ReportPath);
+	}
+
+	if (Params.bQuitOnFinish)
+	{
+		FPlatformMisc::RequestExit(/*bForce*/false);
+	}
+}
+
+// Registers generated setting tags for specified amount of rows as transient native tags, so nothing is written to tag configs
+bool FSettingsBenchmark::RegisterBenchmarkTags(int32 RowsNum)
+{
+	TArray<TUniquePtr<FNativeGameplayTag>>& NativeTags = SettingsBenchmark::NativeTags;
+	NativeTags.Reserve(RowsNum);
+	for (int32 RowIndex = NativeTags.Num(); RowIndex < RowsNum; ++RowIndex)
+	{
+		const FName TagName(*SettingsBenchmark::GetTagString(RowIndex));
+		NativeTags.Emplace(MakeUnique<FNativeGameplayTag>(UE_PLUGIN_NAME, UE_MODULE_NAME, TagName, TEXT("Generated by the settings benchmark"), ENativeGameplayTagToken::PRIVATE_USE_MACRO_INSTEAD));
+	}
+
+	return ensureMsgf(GetBenchmarkTag(RowsNum - 1).IsValid(), TEXT("ASSERT: [%i] %hs:\nGenerated setting tags are not registered!"), __LINE__, __FUNCTION__);
+}
+
+// Removes all generated setting tags from the gameplay tags manager once the benchmark is finished
+void FSettingsBenchmark::UnregisterBenchmarkTags()
+{
+	SettingsBenchmark::NativeTags.Empty();
+}
+
+// Measures cases that don't require any widget
+void FSettingsBenchmark::RunDataCases(const USettingsDataTable& DataTable, int32 RowsNum, const FSettingsBenchmarkParams& Params, TArray<FSettingsBenchmarkResult>& OutResults)
+{
+	TSet<const USettingsDataTable*> DataTables;
+	DataTables.Add(&DataTable);
+
+	TMap<FName, FSettingsPicker> SettingRows;
+	OutResults.Emplace(SettingsBenchmark::Measure(TEXT("GenerateSettingRows"), RowsNum, Params, &SettingsBenchmark::NoSetup, [&]
+	{
+		USettingsUtilsLibrary::GenerateSettingRows(DataTables, SettingRows);
+	}));
+}
+
+// Measures cases on specified Settings Widget
+void FSettingsBenchmark::RunWidgetCases(USettingsWidget& SettingsWidget, const USettingsDataTable& DataTable, int32 RowsNum, const FSettingsBenchmarkParams& Params, TArray<FSettingsBenchmarkResult>& OutResults)
+{
+	using namespace SettingsBenchmark;
+
+	SettingsWidget.RemoveAllSettings();
+	SettingsWidget.SetDataTablesOverride({&DataTable});
+
+	// Is called before each construction to not measure the garbage of previous iteration
+	const auto RemoveSettings = [&SettingsWidget]
+	{
+		SettingsWidget.RemoveAllSettings();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	};
+
+	OutResults.Emplace(Measure(TEXT("CacheTable"), RowsNum, Params, &NoSetup, [&SettingsWidget]
+	{
+		SettingsWidget.CacheTable();
+	}));
+
+	// Cheat manager searches rows by part of the tag, so short names are used
+	TArray<FName> PotentialTagNames;
+	PotentialTagNames.Reserve(RowsNum);
+	for (int32 RowIndex = 0; RowIndex < RowsNum; ++RowIndex)
+	{
+		PotentialTagNames.Emplace(*FString::Printf(TEXT("Row%d"), RowIndex));
+	}
+
+	OutResults.Emplace(Measure(TEXT("FindSettingRow"), RowsNum, Params, &NoSetup, [&]
+	{
+		for (const FName PotentialTagNameIt : PotentialTagNames)
+		{
+			SettingsWidget.FindSettingRow(PotentialTagNameIt);
+		}
+	}));
+
+	if (!SettingsWidget.GetContentHorizontalBox())
+	{
+		UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("Benchmark: '%s' has no bound widgets, construction cases are skipped"), *GetNameSafe(SettingsWidget.GetClass()));
+		SettingsWidget.RemoveAllSettings();
+		return;
+	}
+
+	OutResults.Emplace(Measure(TEXT("ConstructSettings"), RowsNum, Params, RemoveSettings, [&SettingsWidget]
+	{
+		SettingsWidget.ConstructSettings();
+	}));
+
+	OutResults.Emplace(Measure(TEXT("UpdateAllSettings"), RowsNum, Params, &NoSetup, [&SettingsWidget]
+	{
+		SettingsWidget.UpdateAllSettings();
+	}));
+
+	TArray<FSettingTag> LeaderTags;
+	const int32 GroupSize = Params.FanOut + 1;
+	for (int32 RowIndex = 0; RowIndex < RowsNum; RowIndex += GroupSize)
+	{
+		LeaderTags.Emplace(GetBenchmarkTag(RowIndex));
+	}
+
+	OutResults.Emplace(Measure(TEXT("Propagation"), RowsNum, Params, &NoSetup, [&]
+	{
+		for (const FSettingTag& LeaderTagIt : LeaderTags)
+		{
+			SettingsWidget.SetSettingCheckbox(LeaderTagIt, !SettingsWidget.GetCheckboxValue(LeaderTagIt));
+		}
+	}));
+
+	// Only the dedicated benchmark owner is saved into own config, while Game User Settings are not applied to not change the real user config
+	OutResults.Emplace(Measure(TEXT("SaveOwners"), RowsNum, Params, &NoSetup, [&SettingsWidget]
+	{
+		FSettingsEngine::SaveOwners(SettingsWidget.GetRowStore(), &SettingsWidget);
+	}));
+
+	// Repeats what is done when any Settings Data Table is added or removed from the Settings Data Registry
+	OutResults.Emplace(Measure(TEXT("RegistryRebuild"), RowsNum, Params, &NoSetup, [&SettingsWidget]
+	{
+		SettingsWidget.RemoveAllSettings();
+		SettingsWidget.ConstructSettings();
+	}));
+
+	// Compares Slate timings of each invalidation mode, where every frame one leading setting is changed and whole menu is repainted
+	if (FSlateApplication::IsInitialized() && FSlateApplication::Get().GetRenderer())
+	{
+		const UEnum* InvalidationModeEnum = StaticEnum<ESettingsInvalidationMode>();
+		for (int32 EnumIndex = 0; EnumIndex < InvalidationModeEnum->NumEnums() - 1; ++EnumIndex)
+		{
+			const ESettingsInvalidationMode InvalidationMode = static_cast<ESettingsInvalidationMode>(InvalidationModeEnum->GetValueByIndex(EnumIndex));
+			SettingsWidget.SetInvalidationModeOverride(InvalidationMode);
+
+			// Rebuild whole Slate hierarchy to wrap it with new invalidation roots
+			SettingsWidget.RemoveAllSettings();
+			SettingsWidget.ReleaseSlateResources(/*bReleaseChildren*/true);
+			const TSharedRef<SWidget> SlateWidget = SettingsWidget.TakeWidget();
+			SettingsWidget.ConstructSettings();
+			PaintWidget(SlateWidget);
+
+			int32 LeaderIndex = 0;
+			const FString CaseName = FString::Printf(TEXT("Paint.%s"), *InvalidationModeEnum->GetNameStringByIndex(EnumIndex));
+			OutResults.Emplace(Measure(*CaseName, RowsNum, Params, &NoSetup, [&]
+			{
+				if (LeaderTags.IsValidIndex(LeaderIndex))
+				{
+					const FSettingTag& LeaderTag = LeaderTags[LeaderIndex];
+					SettingsWidget.SetSettingCheckbox(LeaderTag, !SettingsWidget.GetCheckboxValue(LeaderTag));
+					LeaderIndex = (LeaderIndex + 1) % LeaderTags.Num();
+				}
+				PaintWidget(SlateWidget);
+			}));
+		}
+
+		SettingsWidget.SetInvalidationModeOverride({});
+	}
+
+	SettingsWidget.RemoveAllSettings();
+	SettingsWidget.ReleaseSlateResources(/*bReleaseChildren*/true);
+}
+
+// Creates new Settings Widget to measure, is never the Settings Widget shown in game
+USettingsWidget* FSettingsBenchmark::CreateSettingsWidget(UWorld& World, const FSettingsBenchmarkParams& Params)
+{
+	UClass* WidgetClass = nullptr;
+	if (!Params.WidgetClass.IsNull())
+	{
+		WidgetClass = Params.WidgetClass.TryLoadClass<USettingsWidget>();
+	}
+	else if (const USettingsWidget* ShownSettingsWidget = USettingsUtilsLibrary::GetSettingsWidget(&World))
+	{
+		WidgetClass = ShownSettingsWidget->GetClass();
+	}
+
+	if (!WidgetClass || WidgetClass->HasAnyClassFlags(CLASS_Abstract))
+	{
+		return nullptr;
+	}
+
+	return CreateWidget<USettingsWidget>(&World, WidgetClass);
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,11 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Profiling/SettingsBenchmarkOwner.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsBenchmarkOwner)
+
+// Returns the owner of all benchmark settings, is picked as 'Owner' function by generated rows
+UObject* USettingsBenchmarkOwner::GetBenchmarkOwner(const UObject* WorldContext)
+{
+	return GetMutableDefault<USettingsBenchmarkOwner>();
+}
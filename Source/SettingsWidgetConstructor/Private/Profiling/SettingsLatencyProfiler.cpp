@@ -0,0 +1,135 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Profiling/SettingsLatencyProfiler.h"
+//---
+#include "SettingsWidgetConstructorModule.h"
+//---
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if !UE_BUILD_SHIPPING
+namespace SettingsLatencyProfiler
+{
+	/** All recorded calls by setting tag and call kind. */
+	static TMap<TPair<FName, ESettingCallKind>, FSettingCallStats> Records;
+
+	static bool bEnabled = false;
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("SettingsWidgetConstructor.Profiler.Enable"),
+		bEnabled,
+		TEXT("If 1, wall time of game-side getters, setters, combobox members and owner functions of settings is recorded."),
+		ECVF_Cheat);
+
+	static int32 OverlayRowsNum = 0;
+	static FAutoConsoleVariableRef CVarOverlayRowsNum(
+		TEXT("SettingsWidgetConstructor.Profiler.Overlay"),
+		OverlayRowsNum,
+		TEXT("Amount of slowest settings to draw over the Settings Widget, 0 disables the overlay."),
+		ECVF_Cheat);
+
+#if !UE_BUILD_SHIPPING
+	static FAutoConsoleCommandWithArgsAndOutputDevice TopCommand(
+		TEXT("SettingsWidgetConstructor.Profiler.Top"),
+		TEXT("Prints settings with the slowest game-side calls, optional arg is the amount of settings to print, 10 by default."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			const int32 Num = Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 10;
+			TArray<FSettingCallStats> TopStats;
+			FSettingsLatencyProfiler::GetTopOffenders(Num, TopStats);
+
+			Ar.Logf(TEXT("Settings latency, %d slowest of %d records (total / avg / max ms, calls):"), TopStats.Num(), Records.Num());
+			for (const FSettingCallStats& StatsIt : TopStats)
+			{
+				Ar.Logf(TEXT("  %s %s: %.3f / %.3f / %.3f, %d"), *StatsIt.Tag.ToString(), FSettingsLatencyProfiler::GetCallKindName(StatsIt.Kind), StatsIt.TotalMs, StatsIt.GetAvgMs(), StatsIt.MaxMs, StatsIt.CallsNum);
+			}
+		}));
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("SettingsWidgetConstructor.Profiler.Dump"),
+		TEXT("Writes all recorded settings calls to 'Saved/SettingsWidgetConstructor/Profiler' as CSV."),
+		FConsoleCommandDelegate::CreateStatic([]
+		{
+			const FString CsvPath = FSettingsLatencyProfiler::DumpToCsv();
+			UE_LOG(LogSettingsWidgetConstructor, Display, TEXT("Settings latency is written to '%s'"), *CsvPath);
+		}));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("SettingsWidgetConstructor.Profiler.Reset"),
+		TEXT("Clears all recorded settings calls."),
+		FConsoleCommandDelegate::CreateStatic(&FSettingsLatencyProfiler::Reset));
+}
+
+// Returns true if calls have to be recorded
+bool FSettingsLatencyProfiler::IsEnabled()
+{
+	return SettingsLatencyProfiler::bEnabled;
+}
+
+// Returns how many slowest settings have to be drawn over the Settings Widget, 0 if overlay is disabled
+int32 FSettingsLatencyProfiler::GetOverlayRowsNum()
+{
+	return IsEnabled() ? FMath::Max(SettingsLatencyProfiler::OverlayRowsNum, 0) : 0;
+}
+
+// Accumulates the wall time of one call of specified setting
+void FSettingsLatencyProfiler::Record(FName Tag, ESettingCallKind Kind, double ElapsedSeconds)
+{
+	FSettingCallStats& Stats = SettingsLatencyProfiler::Records.FindOrAdd({Tag, Kind});
+	Stats.Tag = Tag;
+	Stats.Kind = Kind;
+
+	const double ElapsedMs = ElapsedSeconds * 1000.0;
+	++Stats.CallsNum;
+	Stats.TotalMs += ElapsedMs;
+	Stats.MaxMs = FMath::Max(Stats.MaxMs, ElapsedMs);
+}
+
+// Returns specified amount of records with the longest total time, sorted from the slowest
+void FSettingsLatencyProfiler::GetTopOffenders(int32 Num, TArray<FSettingCallStats>& OutStats)
+{
+	SettingsLatencyProfiler::Records.GenerateValueArray(OutStats);
+	OutStats.Sort([](const FSettingCallStats& A, const FSettingCallStats& B) { return A.TotalMs > B.TotalMs; });
+
+	if (OutStats.Num() > Num)
+	{
+		OutStats.SetNum(FMath::Max(Num, 0));
+	}
+}
+
+// Writes all records as CSV, returns the path of written file or empty string on fail
+FString FSettingsLatencyProfiler::DumpToCsv()
+{
+	TArray<FSettingCallStats> AllStats;
+	GetTopOffenders(SettingsLatencyProfiler::Records.Num(), AllStats);
+
+	FString CsvString = TEXT("Tag,Kind,Calls,TotalMs,AvgMs,MaxMs\n");
+	for (const FSettingCallStats& StatsIt : AllStats)
+	{
+		CsvString += FString::Printf(TEXT("%s,%s,%d,%.4f,%.4f,%.4f\n"), *StatsIt.Tag.ToString(), GetCallKindName(StatsIt.Kind), StatsIt.CallsNum, StatsIt.TotalMs, StatsIt.GetAvgMs(), StatsIt.MaxMs);
+	}
+
+	const FString FileName = FString::Printf(TEXT("SettingsLatency_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("SettingsWidgetConstructor") / TEXT("Profiler") / FileName;
+	return FFileHelper::SaveStringToFile(CsvString, *CsvPath) ? CsvPath : FString();
+}
+
+// Clears all records
+void FSettingsLatencyProfiler::Reset()
+{
+	SettingsLatencyProfiler::Records.Empty();
+}
+
+// Returns the readable name of specified call kind
+const TCHAR* FSettingsLatencyProfiler::GetCallKindName(ESettingCallKind Kind)
+{
+	switch (Kind)
+	{
+	case ESettingCallKind::Getter: return TEXT("Getter");
+	case ESettingCallKind::Setter: return TEXT("Setter");
+	case ESettingCallKind::GetMembers: return TEXT("GetMembers");
+	case ESettingCallKind::Owner: return TEXT("Owner");
+	default: return TEXT("None");
+	}
+}
+#endif // !UE_BUILD_SHIPPING
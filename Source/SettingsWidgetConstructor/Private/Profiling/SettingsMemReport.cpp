@@ -0,0 +1,219 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Profiling/SettingsMemReport.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Data/SettingsRow.h"
+#include "MyUtilsLibraries/SettingsUtilsLibrary.h"
+#include "UI/SettingCombobox.h"
+#include "UI/SettingSubWidget.h"
+#include "UI/SettingsWidget.h"
+//---
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace SettingsMemReport
+{
+	/** Returns bytes allocated by the display string of specified text. */
+	static SIZE_T GetTextBytes(const FText& Text)
+	{
+		return Text.IsEmpty() ? 0 : Text.ToString().GetAllocatedSize();
+	}
+
+	/** Returns bytes allocated by specified tags container, its parent tags are included. */
+	static SIZE_T GetTagsBytes(const FGameplayTagContainer& Tags)
+	{
+		if (Tags.IsEmpty())
+		{
+			return 0;
+		}
+
+		// Array of parent tags is not exposed, so only its used size is estimated, while explicit tags report their allocation
+		const int32 ParentTagsNum = Tags.GetGameplayTagParents().Num() - Tags.Num();
+		return Tags.GetGameplayTagArray().GetAllocatedSize() + FMath::Max(ParentTagsNum, 0) * sizeof(FGameplayTag);
+	}
+
+	/** Returns heap bytes of specified primary data, owner function list is excluded since it's counted separately. */
+	static SIZE_T GetPrimaryHeapBytes(const FSettingsPrimary& Primary)
+	{
+		return GetTextBytes(Primary.Caption) + GetTextBytes(Primary.Tooltip) + GetTagsBytes(Primary.SettingsToUpdate);
+	}
+
+	/** Returns struct size of the archetype data chosen by specified row. */
+	static SIZE_T GetArchetypeStructBytes(const FSettingsPicker& Setting)
+	{
+		const FStructProperty* FoundProperty = CastField<FStructProperty>(FSettingsPicker::StaticStruct()->FindPropertyByName(Setting.SettingsType));
+		return FoundProperty && FoundProperty->Struct ? FoundProperty->Struct->GetStructureSize() : 0;
+	}
+
+	/** Returns heap bytes of specified combobox data. */
+	static SIZE_T GetComboboxHeapBytes(const FSettingsCombobox& Combobox)
+	{
+		SIZE_T Bytes = Combobox.Members.GetAllocatedSize();
+		for (const FText& MemberIt : Combobox.Members)
+		{
+			Bytes += GetTextBytes(MemberIt);
+		}
+		return Bytes;
+	}
+
+	/** Returns shallow bytes of specified widget object. */
+	static SIZE_T GetWidgetBytes(const UObject* Widget)
+	{
+		return Widget ? Widget->GetClass()->GetStructureSize() : 0;
+	}
+
+	/** Prints specified entry. */
+	static void PrintEntry(FOutputDevice& Ar, const TCHAR* Name, const FSettingsMemEntry& Entry)
+	{
+		Ar.Logf(TEXT("  %-32s %8d %12.2f KB"), Name, Entry.Num, Entry.Bytes / 1024.0);
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+		TEXT("SettingsWidgetConstructor.MemReport"),
+		TEXT("Prints bytes held by settings rows, sub-widgets data copies, comboitems and tooltips of the Settings Widget."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const USettingsWidget* SettingsWidget = USettingsUtilsLibrary::GetSettingsWidget(World);
+			if (!SettingsWidget)
+			{
+				Ar.Log(TEXT("Settings Widget is not created, nothing to report"));
+				return;
+			}
+
+			FSettingsMemReport::Gather(*SettingsWidget).Print(Ar);
+		}));
+}
+
+// Collects the report of specified Settings Widget
+FSettingsMemReport FSettingsMemReport::Gather(const USettingsWidget& SettingsWidget)
+{
+	using namespace SettingsMemReport;
+
+	const FSettingsEngine& SettingsEngine = SettingsWidget.SettingsEngineInternal;
+	FSettingsMemReport Report;
+	Report.RowsContainerNum = SettingsEngine.GetRows().Num();
+	Report.RowsContainerBytes = SettingsEngine.GetRows().GetAllocatedSize();
+	Report.RowStoreNum = SettingsEngine.GetRowStore().Num();
+	Report.RowStoreBytes = SettingsEngine.GetRowStore().GetAllocatedSize();
+	Report.RowIndexBytes = SettingsEngine.GetRowStore().Num() > 0 ? SettingsEngine.GetRowStore().GetIndex().GetAllocatedSize() : 0;
+
+	TSet<const TSet<FName>*> CountedOwnerFunctions;
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsEngine.GetRows())
+	{
+		const FSettingsPicker& Setting = RowIt.Value;
+		const FSettingsPrimary& Primary = Setting.PrimaryData;
+
+		// The row itself is stored inline in the rows map, so only its heap allocations are counted here
+		SIZE_T RowBytes = GetPrimaryHeapBytes(Primary);
+		if (Setting.SettingsType == GET_MEMBER_NAME_CHECKED(FSettingsPicker, Combobox))
+		{
+			RowBytes += GetComboboxHeapBytes(Setting.Combobox);
+		}
+		Report.RowsByArchetype.FindOrAdd(Setting.SettingsType).Add(RowBytes);
+
+		// Lists are shared by owner classes, so count each of them only once, while the pointer itself is inline in the row
+		bool bIsAlreadyCounted = true;
+		if (Primary.OwnerFunctionList)
+		{
+			CountedOwnerFunctions.Add(Primary.OwnerFunctionList.Get(), &bIsAlreadyCounted);
+		}
+		if (!bIsAlreadyCounted)
+		{
+			Report.OwnerFunctionLists.Add(sizeof(TSet<FName>) + Primary.OwnerFunctionList->GetAllocatedSize());
+		}
+
+		const USettingSubWidget* SubWidget = Primary.SettingSubWidget.Get();
+		if (!SubWidget)
+		{
+			continue;
+		}
+
+		Report.SubWidgets.Add(GetWidgetBytes(SubWidget));
+
+		const FSettingsPrimary& PrimaryCopy = SubWidget->GetSettingPrimaryRow();
+		Report.SubWidgetPrimaryCopies.Add(GetPrimaryHeapBytes(PrimaryCopy));
+
+		// Other archetypes are read from the row store, only blueprint views of these ones are copied
+		if (SubWidget->IsA<USettingButton>() || SubWidget->IsA<USettingTextLine>())
+		{
+			Report.SubWidgetArchetypeCopies.FindOrAdd(Setting.SettingsType).Add(GetArchetypeStructBytes(Setting));
+		}
+
+		if (const USettingCombobox* SettingCombobox = Cast<USettingCombobox>(SubWidget))
+		{
+			for (const USettingComboitem* ComboitemIt : SettingCombobox->GetComboitemWidgets())
+			{
+				Report.ComboitemWidgets.Add(GetWidgetBytes(ComboitemIt));
+			}
+		}
+
+		// Count own tooltips that were created outside of the shared one
+		const UWidget* ToolTipWidget = SubWidget->GetToolTip();
+		if (ToolTipWidget && ToolTipWidget != SettingsWidget.SharedTooltipInternal)
+		{
+			Report.TooltipWidgets.Add(GetWidgetBytes(ToolTipWidget));
+		}
+	}
+
+	for (const USettingColumn* ColumnIt : SettingsWidget.ColumnsInternal)
+	{
+		if (ColumnIt)
+		{
+			Report.SubWidgets.Add(GetWidgetBytes(ColumnIt));
+		}
+	}
+
+	if (SettingsWidget.SharedTooltipInternal)
+	{
+		Report.TooltipWidgets.Add(GetWidgetBytes(SettingsWidget.SharedTooltipInternal));
+	}
+
+	return Report;
+}
+
+// Returns summary bytes of the whole report
+SIZE_T FSettingsMemReport::GetTotalBytes() const
+{
+	SIZE_T TotalBytes = RowsContainerBytes + RowStoreBytes + RowIndexBytes + OwnerFunctionLists.Bytes + SubWidgetPrimaryCopies.Bytes + SubWidgets.Bytes + ComboitemWidgets.Bytes + TooltipWidgets.Bytes;
+
+	for (const TTuple<FName, FSettingsMemEntry>& It : RowsByArchetype)
+	{
+		TotalBytes += It.Value.Bytes;
+	}
+
+	// Archetype copies are inline in sub-widgets, so they are already counted by SubWidgets
+	return TotalBytes;
+}
+
+// Prints the report to specified output device, e.g: to the log
+void FSettingsMemReport::Print(FOutputDevice& Ar) const
+{
+	using namespace SettingsMemReport;
+
+	Ar.Logf(TEXT("Settings memory report, total: %.2f KB"), GetTotalBytes() / 1024.0);
+	Ar.Logf(TEXT("  %-32s %8s %15s"), TEXT("Kind"), TEXT("Num"), TEXT("Size"));
+
+	for (const TTuple<FName, FSettingsMemEntry>& It : RowsByArchetype)
+	{
+		PrintEntry(Ar, *FString::Printf(TEXT("Rows.%s"), *It.Key.ToString()), It.Value);
+	}
+
+	PrintEntry(Ar, TEXT("Rows.Container"), {RowsContainerNum, RowsContainerBytes});
+	PrintEntry(Ar, TEXT("Rows.OwnerFunctionList"), OwnerFunctionLists);
+	PrintEntry(Ar, TEXT("Rows.Store"), {RowStoreNum, RowStoreBytes});
+	PrintEntry(Ar, TEXT("Rows.SharedIndex"), {RowStoreNum, RowIndexBytes});
+	PrintEntry(Ar, TEXT("SubWidgets"), SubWidgets);
+	PrintEntry(Ar, TEXT("SubWidgets.PrimaryData"), SubWidgetPrimaryCopies);
+
+	for (const TTuple<FName, FSettingsMemEntry>& It : SubWidgetArchetypeCopies)
+	{
+		PrintEntry(Ar, *FString::Printf(TEXT("SubWidgets.%sData (inline)"), *It.Key.ToString()), It.Value);
+	}
+
+	PrintEntry(Ar, TEXT("ComboitemWidgets"), ComboitemWidgets);
+	PrintEntry(Ar, TEXT("TooltipWidgets"), TooltipWidgets);
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -2,7 +2,9 @@
 
 #include "SettingsCheatExtension.h"
 //---
-#include "MyUtilsLibraries/SWCWidgetUtilsLibrary.h"
+#include "Data/SettingsEngine.h"
+#include "MyUtilsLibraries/SettingsUtilsLibrary.h"
+#include "Subsystems/SettingsCatalogSubsystem.h"
 #include "UI/SettingsWidget.h"
 //---
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsCheatExtension)
@@ -30,12 +32,6 @@ void USettingsCheatExtension::OnCheatManagerCreated(UCheatManager* CheatManager)
 // Override the setting value with the cheat
 void USettingsCheatExtension::CheatSetting(const FString& TagByValue) const
 {
-	USettingsWidget* SettingsWidget = FSWCWidgetUtilsLibrary::FindWidgetOfClass<USettingsWidget>(GetWorld());
-	if (!SettingsWidget)
-	{
-		return;
-	}
-
 	if (TagByValue.IsEmpty())
 	{
 		return;
@@ -65,6 +61,16 @@ void USettingsCheatExtension::CheatSetting(const FString& TagByValue) const
 		TagValue = SeparatedStrings[ValueIndex];
 	}
 
-	SettingsWidget->SetSettingValue(TagName, TagValue);
-	SettingsWidget->SaveSettings();
+	if (USettingsWidget* SettingsWidget = USettingsUtilsLibrary::GetSettingsWidgetByPlayer(GetPlayerController()))
+	{
+		SettingsWidget->SetSettingValue(TagName, TagValue);
+		SettingsWidget->SaveSettings();
+	}
+	else if (USettingsCatalogSubsystem* CatalogSubsystem = USettingsCatalogSubsystem::Get(GetPlayerController()))
+	{
+		// There is no UI, e.g: on dedicated server, so set it by the headless engine
+		FSettingsEngine& SettingsEngine = CatalogSubsystem->GetSettingsEngine();
+		SettingsEngine.SetSettingValue(TagName, TagValue);
+		SettingsEngine.SaveSettings();
+	}
 }
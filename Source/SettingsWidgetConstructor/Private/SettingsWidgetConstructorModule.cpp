@@ -2,7 +2,32 @@
 
 #include "SettingsWidgetConstructorModule.h"
 //---
+#include "SettingsWidgetConstructorStats.h"
+#include "Data/SettingsStyleSet.h"
+#include "Data/SettingsTextCache.h"
+//---
 #include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY(LogSettingsWidgetConstructor);
+
+// Cycle counters
+DEFINE_STAT(STAT_SWC_ConstructSettings);
+DEFINE_STAT(STAT_SWC_CacheTable);
+DEFINE_STAT(STAT_SWC_GenerateAllSettingRows);
+DEFINE_STAT(STAT_SWC_GetAllSettingDataTables);
+DEFINE_STAT(STAT_SWC_BindSetting);
+DEFINE_STAT(STAT_SWC_AddSetting);
+DEFINE_STAT(STAT_SWC_UpdateSettingsByTags);
+DEFINE_STAT(STAT_SWC_SaveSettings);
+DEFINE_STAT(STAT_SWC_ApplySettings);
+
+// Counters
+DEFINE_STAT(STAT_SWC_GetterCalls);
+DEFINE_STAT(STAT_SWC_SetterCalls);
+DEFINE_STAT(STAT_SWC_WidgetsCreated);
+DEFINE_STAT(STAT_SWC_PropagationDepth);
+DEFINE_STAT(STAT_SWC_RedundantWritesAvoided);
+
 // Called right after the module DLL has been loaded and the module object has been created
 void FSettingsWidgetConstructorModule::StartupModule()
 {
@@ -14,6 +39,9 @@ void FSettingsWidgetConstructorModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FSettingsStyleSet::Shutdown();
+	FSettingsTextCache::Shutdown();
 }
 
 IMPLEMENT_MODULE(FSettingsWidgetConstructorModule, SettingsWidgetConstructor)
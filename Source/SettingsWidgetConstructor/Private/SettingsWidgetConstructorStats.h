@@ -0,0 +1,30 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stats of the Settings Widget Constructor, are shown by 'stat SettingsWidgetConstructor' console command.
+ * Each cycle counter is paired with the trace scope of the same function, so it's also visible in Unreal Insights.
+ */
+DECLARE_STATS_GROUP(TEXT("SettingsWidgetConstructor"), STATGROUP_SettingsWidgetConstructor, STATCAT_Advanced);
+
+// Cycle counters
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Construct Settings"), STAT_SWC_ConstructSettings, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cache Table"), STAT_SWC_CacheTable, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Generate All Setting Rows"), STAT_SWC_GenerateAllSettingRows, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Get All Setting Data Tables"), STAT_SWC_GetAllSettingDataTables, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Bind Setting"), STAT_SWC_BindSetting, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Add Setting"), STAT_SWC_AddSetting, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Settings By Tags"), STAT_SWC_UpdateSettingsByTags, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save Settings"), STAT_SWC_SaveSettings, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Settings"), STAT_SWC_ApplySettings, STATGROUP_SettingsWidgetConstructor, );
+
+// Counters, are reset every frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Getter Calls"), STAT_SWC_GetterCalls, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Setter Calls"), STAT_SWC_SetterCalls, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Widgets Created"), STAT_SWC_WidgetsCreated, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Propagation Depth (Max)"), STAT_SWC_PropagationDepth, STATGROUP_SettingsWidgetConstructor, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Redundant Writes Avoided"), STAT_SWC_RedundantWritesAvoided, STATGROUP_SettingsWidgetConstructor, );
@@ -0,0 +1,195 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Subsystems/SettingsCatalogSubsystem.h"
+//---
+#include "Data/SettingsDataAsset.h"
+#include "Data/SettingsEngine.h"
+#include "Data/SettingsSharedCatalog.h"
+//---
+#include "Async/ParallelFor.h"
+#include "DataRegistry.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsCatalogSubsystem)
+
+// Returns this subsystem of the game instance of specified object's world
+USettingsCatalogSubsystem* USettingsCatalogSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<ThisClass>() : nullptr;
+}
+
+// Collects names of all functions of specified owner class, is used when there is no game instance, e.g: in editor preview
+TSharedRef<const TSet<FName>> USettingsCatalogSubsystem::MakeOwnerFunctions(const UClass& OwnerClass)
+{
+	const TSharedRef<TSet<FName>> OwnerFunctions = MakeShared<TSet<FName>>();
+	for (TFieldIterator<UFunction> It(&OwnerClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		const UFunction* FunctionIt = *It;
+		if (!FunctionIt)
+		{
+			continue;
+		}
+
+		const FName FunctionNameIt = FunctionIt->GetFName();
+		if (!FunctionNameIt.IsNone())
+		{
+			OwnerFunctions->Emplace(FunctionNameIt);
+		}
+	}
+
+	return OwnerFunctions;
+}
+
+// Returns the catalog merged from specified tables, is built only if there is no catalog of the same tables yet
+TSharedRef<const FSettingsSharedCatalog> USettingsCatalogSubsystem::GetSharedCatalog(const TSet<const USettingsDataTable*>& DataTables)
+{
+	if (!SharedCatalogInternal
+	    || !SharedCatalogInternal->IsBuiltFrom(DataTables))
+	{
+		// Tables are changed, e.g: DLC table is added to the Settings Data Registry or rows are edited in PIE
+		SharedCatalogInternal = FSettingsSharedCatalog::Build(DataTables);
+	}
+
+	return SharedCatalogInternal.ToSharedRef();
+}
+
+// Returns names of all functions of specified owner class, are shared by all rows and players with the same owner class
+TSharedRef<const TSet<FName>> USettingsCatalogSubsystem::GetOwnerFunctions(const UClass& OwnerClass)
+{
+	if (const TSharedRef<const TSet<FName>>* FoundOwnerFunctions = OwnerFunctionsInternal.Find(FObjectKey(&OwnerClass)))
+	{
+		return *FoundOwnerFunctions;
+	}
+
+	return OwnerFunctionsInternal.Emplace(FObjectKey(&OwnerClass), MakeOwnerFunctions(OwnerClass));
+}
+
+// Collects functions of all specified owner classes that are not cached yet in parallel, so rows are bound on the game thread without walking classes
+void USettingsCatalogSubsystem::CacheOwnerFunctions(TConstArrayView<const UClass*> OwnerClasses)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsCatalogSubsystem::CacheOwnerFunctions);
+
+	TArray<const UClass*> NewClasses;
+	for (const UClass* OwnerClassIt : OwnerClasses)
+	{
+		if (OwnerClassIt
+		    && !OwnerFunctionsInternal.Contains(FObjectKey(OwnerClassIt)))
+		{
+			NewClasses.AddUnique(OwnerClassIt);
+		}
+	}
+
+	// Prepare: classes are only read, while the game thread waits here, so the garbage collector can't run meanwhile
+	TArray<TSharedPtr<const TSet<FName>>> NewFunctions;
+	NewFunctions.SetNum(NewClasses.Num());
+	ParallelFor(NewClasses.Num(), [&NewClasses, &NewFunctions](int32 Index)
+	{
+		NewFunctions[Index] = MakeOwnerFunctions(*NewClasses[Index]);
+	});
+
+	// Commit
+	for (int32 Index = 0; Index < NewClasses.Num(); ++Index)
+	{
+		OwnerFunctionsInternal.Emplace(FObjectKey(NewClasses[Index]), NewFunctions[Index].ToSharedRef());
+	}
+}
+
+// Returns amount of rows in the shared catalog, or 0 if it's not built yet
+int32 USettingsCatalogSubsystem::GetSharedRowsNum() const
+{
+	return SharedCatalogInternal ? SharedCatalogInternal->Num() : 0;
+}
+
+// Releases the shared catalog and owner functions, so they are built again on next request
+void USettingsCatalogSubsystem::InvalidateSharedCatalog()
+{
+	SharedCatalogInternal.Reset();
+	OwnerFunctionsInternal.Empty();
+
+	// The engine is bound to the released catalog, so it's initialized again on next request
+	if (SettingsEngineInternal)
+	{
+		SettingsEngineInternal->Reset();
+	}
+}
+
+// Is called when tables are added to or removed from the Settings Data Registry, so the headless engine takes rows of new tables on next request
+void USettingsCatalogSubsystem::OnSettingsDataRegistryChanged(UDataRegistry* SettingsDataRegistry)
+{
+	// The shared catalog is checked against requested tables by itself, while the engine is bound to all tables registered before
+	if (SettingsEngineInternal)
+	{
+		SettingsEngineInternal->Reset();
+	}
+}
+
+// Returns the headless Settings Engine bound to all Settings Data Tables, is initialized on first request
+FSettingsEngine& USettingsCatalogSubsystem::GetSettingsEngine()
+{
+	if (!SettingsEngineInternal)
+	{
+		SettingsEngineInternal = MakeShared<FSettingsEngine>();
+	}
+
+	if (!SettingsEngineInternal->IsInitialized()
+	    || !SettingsEngineInternal->IsUpToDate())
+	{
+		// Rows are not taken yet or their tables were changed, e.g: edited in PIE
+		SettingsEngineInternal->Initialize(GetGameInstance(), /*DataTables*/ {});
+	}
+	else
+	{
+		// Some owners might be initialized since the last request
+		SettingsEngineInternal->TryRebindDeferred();
+	}
+
+	return *SettingsEngineInternal;
+}
+
+// Returns the current value of specified setting in a string format without any Settings Widget
+FString USettingsCatalogSubsystem::GetSettingValueHeadless(FName TagName)
+{
+	FString Value;
+	GetSettingsEngine().GetSettingValue(TagName, /*Out*/ Value);
+	return Value;
+}
+
+// Sets the value of specified setting in a string format without any Settings Widget
+bool USettingsCatalogSubsystem::SetSettingValueHeadless(FName TagName, const FString& Value)
+{
+	return GetSettingsEngine().SetSettingValue(TagName, Value);
+}
+
+// Applies and saves all settings set without any Settings Widget
+void USettingsCatalogSubsystem::SaveSettingsHeadless()
+{
+	GetSettingsEngine().SaveSettings();
+}
+
+// Is overridden to track changes of the Settings Data Registry
+void USettingsCatalogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (UDataRegistry* SettingsDataRegistry = USettingsDataAsset::Get().GetSettingsDataRegistry())
+	{
+		SettingsDataRegistry->OnCacheVersionInvalidated().AddUObject(this, &ThisClass::OnSettingsDataRegistryChanged);
+	}
+}
+
+// Is overridden to release all shared data
+void USettingsCatalogSubsystem::Deinitialize()
+{
+	if (UDataRegistry* SettingsDataRegistry = USettingsDataAsset::Get().GetSettingsDataRegistrySoft().Get())
+	{
+		SettingsDataRegistry->OnCacheVersionInvalidated().RemoveAll(this);
+	}
+
+	InvalidateSharedCatalog();
+
+	Super::Deinitialize();
+}
@@ -0,0 +1,59 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Subsystems/SettingsWidgetSubsystem.h"
+//---
+#include "UI/SettingsWidget.h"
+//---
+#include "Engine/Engine.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsWidgetSubsystem)
+
+// Returns this subsystem of the local player that owns specified object, or of the first local player in its world
+USettingsWidgetSubsystem* USettingsWidgetSubsystem::Get(const UObject* WorldContextObject)
+{
+	const ULocalPlayer* LocalPlayer = nullptr;
+	if (const UUserWidget* Widget = Cast<UUserWidget>(WorldContextObject))
+	{
+		LocalPlayer = Widget->GetOwningLocalPlayer();
+	}
+	else if (const APlayerController* PlayerController = Cast<APlayerController>(WorldContextObject))
+	{
+		LocalPlayer = PlayerController->GetLocalPlayer();
+	}
+	else
+	{
+		LocalPlayer = Cast<ULocalPlayer>(WorldContextObject);
+	}
+
+	if (!LocalPlayer)
+	{
+		const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+		LocalPlayer = World ? World->GetFirstLocalPlayerFromController() : nullptr;
+	}
+
+	return LocalPlayer ? LocalPlayer->GetSubsystem<ThisClass>() : nullptr;
+}
+
+// Registers specified widget as the Settings Widget of this local player
+void USettingsWidgetSubsystem::RegisterSettingsWidget(USettingsWidget* SettingsWidget)
+{
+	if (!ensureMsgf(SettingsWidget, TEXT("ASSERT: [%i] %hs:\n'SettingsWidget' is null!"), __LINE__, __FUNCTION__))
+	{
+		return;
+	}
+
+	SettingsWidgetInternal = SettingsWidget;
+}
+
+// Unregisters specified widget if it is the registered Settings Widget of this local player
+void USettingsWidgetSubsystem::UnregisterSettingsWidget(const USettingsWidget* SettingsWidget)
+{
+	if (SettingsWidget
+		&& SettingsWidgetInternal.Get() == SettingsWidget)
+	{
+		SettingsWidgetInternal.Reset();
+	}
+}
@@ -3,7 +3,9 @@
 #include "UI/SettingCombobox.h"
 //---
 #include "Data/SettingsDataAsset.h"
+#include "Data/SettingsTextCache.h"
 #include "MyUtilsLibraries/SWCWidgetUtilsLibrary.h"
+#include "SettingsWidgetConstructorStats.h"
 #include "UI/SettingsWidget.h"
 //---
 #include "Components/Border.h"
@@ -16,20 +18,75 @@
 // Set the new combobox setting data for this widget
 void USettingCombobox::SetComboboxData(const FSettingsCombobox& InComboboxData)
 {
-	ComboboxDataInternal = InComboboxData;
+	FSettingsPicker* SettingRow = GetSettingRowMutable();
+	if (ensureMsgf(SettingRow, TEXT("ASSERT: [%i] %hs:\n'%s' setting is not found in the Settings Widget, the data can't be set!"), __LINE__, __FUNCTION__, *SettingTagInternal.ToString()))
+	{
+		SettingRow->Combobox = InComboboxData;
+	}
 }
 
 // Internal function to change the value of this subwidget
 void USettingCombobox::SetComboboxIndex(int32 InValue)
 {
-	if (ensureMsgf(ComboboxWidget, TEXT("ERROR: [%i] %hs:\n'ComboboxWidget' is null!"), __LINE__, __FUNCTION__))
+	if (ensureMsgf(ComboboxWidget, TEXT("ERROR: [%i] %hs:\n'ComboboxWidget' is null!"), __LINE__, __FUNCTION__)
+	    && ComboboxWidget->GetSelectedIndex() != InValue)
 	{
+		// Don't invalidate the combobox if it already shows this option, e.g: when it's chosen by the player
 		ComboboxWidget->SetSelectedIndex(InValue);
 	}
 
 	K2_OnSetComboboxIndex(InValue);
 }
 
+// Is overridden to update texts of comboitems in place, options are refilled only if IDs of members are changed
+void USettingCombobox::RefreshTexts()
+{
+	Super::RefreshTexts();
+
+	if (!ComboboxWidget)
+	{
+		return;
+	}
+
+	// Localized members keep their IDs in any culture, only not localized ones can be changed by their owner
+	const TArray<FText>& Members = GetComboboxData().Members;
+	bool bAreIdsChanged = Members.Num() != ComboitemWidgets.Num();
+	for (int32 Index = 0; !bAreIdsChanged && Index < Members.Num(); ++Index)
+	{
+		const FString TextId = FSettingsTextCache::MakeTextId(Members[Index]);
+		const TWeakObjectPtr<USettingComboitem>* FoundComboitem = ComboitemsByTextIdInternal.Find(TextId);
+		bAreIdsChanged = !FoundComboitem || FoundComboitem->Get() != ComboitemWidgets[Index];
+	}
+
+	if (!bAreIdsChanged)
+	{
+		// Just push new display strings into existing comboitems
+		for (int32 Index = 0; Index < Members.Num(); ++Index)
+		{
+			if (USettingComboitem* ComboitemIt = ComboitemWidgets[Index])
+			{
+				ComboitemIt->SetItemTextValue(Members[Index]);
+			}
+		}
+		return;
+	}
+
+	// Members are changed completely, so refill options and keep the chosen one
+	const int32 SelectedIndex = ComboboxWidget->GetSelectedIndex();
+	ComboboxWidget->ClearOptions();
+	ComboitemWidgets.Reset();
+	ComboitemsByTextIdInternal.Reset();
+	for (const FText& It : Members)
+	{
+		CreateComboitem(It);
+	}
+
+	if (SelectedIndex != INDEX_NONE)
+	{
+		ComboboxWidget->SetSelectedIndex(SelectedIndex);
+	}
+}
+
 // Is the earliest point where the BindWidget properties are constructed
 TSharedRef<SWidget> USettingCombobox::RebuildWidget()
 {
@@ -134,10 +191,8 @@ void USettingComboitem::ApplyTheme_Implementation(const FSettingsCombobox& Combo
 // Is overridden to construct the combobox
 void USettingCombobox::OnAddSetting(const FSettingsPicker& Setting)
 {
-	ComboboxDataInternal = Setting.Combobox;
-
 	// Add new items
-	for (const FText& It : ComboboxDataInternal.Members)
+	for (const FText& It : Setting.Combobox.Members)
 	{
 		CreateComboitem(It);
 	}
@@ -170,15 +225,16 @@ void USettingCombobox::CreateComboitem(const FText& ItemTextValue)
 
 	// LOC-1. Prespawn own comboitem widget
 	USettingComboitem* ComboitemWidget = CreateWidget<USettingComboitem>(this, ComboitemClass);
+	INC_DWORD_STAT(STAT_SWC_WidgetsCreated);
 	checkf(ComboitemWidget, TEXT("ERROR: [%i] %hs:\n'ComboitemWidget' is null!"), __LINE__, __FUNCTION__);
-	ComboitemWidget->ApplyTheme(ComboboxDataInternal);
+	ComboitemWidget->ApplyTheme(GetComboboxData());
 	ComboitemWidget->SetItemTextValue(ItemTextValue);
 	ComboitemWidgets.Add(ComboitemWidget);
 
 	// LOC-2. Init Text ID strings; ID may be null if Text is not localized, then use the string value directly
-	const FTextKey FoundTextId = FTextInspector::GetTextId(ItemTextValue).GetKey();
-	const FString FinalTextId = !FoundTextId.IsEmpty() ? FoundTextId.ToString() : ItemTextValue.ToString();
+	const FString FinalTextId = FSettingsTextCache::MakeTextId(ItemTextValue);
 	checkf(!FinalTextId.IsEmpty(), TEXT("ERROR: [%i] %hs:\n'!FinalTextId' is empty, can not construct comboitem from '%s' value!"), __LINE__, __FUNCTION__, *ItemTextValue.ToString());
+	ComboitemsByTextIdInternal.Emplace(FinalTextId, ComboitemWidget);
 	ComboboxWidget->AddOption(FinalTextId);
 }
 
@@ -192,15 +248,22 @@ UWidget* USettingCombobox::OnConstructComboitem(FString ItemTextId)
 	}
 
 	// LOC-3. Return to the engine own comboitem widget by given Text Id
-	const TObjectPtr<USettingComboitem>* FoundComboitemPtr = ComboitemWidgets.FindByPredicate([&ItemTextId](const USettingComboitem* It)
+	const TWeakObjectPtr<USettingComboitem>* FoundComboitemPtr = ComboitemsByTextIdInternal.Find(ItemTextId);
+	USettingComboitem* FoundComboitem = FoundComboitemPtr ? FoundComboitemPtr->Get() : nullptr;
+	if (!FoundComboitem)
 	{
-		const FText ItemText = It ? It->GetItemTextValue() : FText::GetEmpty();
-		const FTextKey FoundTextId = FTextInspector::GetTextId(ItemText).GetKey();
-		const bool bIsFoundKey = !FoundTextId.IsEmpty() && FoundTextId.ToString() == ItemTextId;
-		return bIsFoundKey
-			|| It->GetItemTextValue().ToString() == ItemTextId; // ID may be null if Text is not localized, so compare the string value directly
-	});
+		// Comboitem might be added directly to the array, e.g: by Blueprint, so find it by its text once and remember
+		const TObjectPtr<USettingComboitem>* FoundComboitemIt = ComboitemWidgets.FindByPredicate([&ItemTextId](const USettingComboitem* It)
+		{
+			return It && FSettingsTextCache::MakeTextId(It->GetItemTextValue()) == ItemTextId;
+		});
+		FoundComboitem = FoundComboitemIt ? FoundComboitemIt->Get() : nullptr;
+		if (FoundComboitem)
+		{
+			ComboitemsByTextIdInternal.Emplace(ItemTextId, FoundComboitem);
+		}
+	}
 
-	ensureMsgf(FoundComboitemPtr, TEXT("ASSERT: [%i] %hs:\nFailed to find the comboitem widget by the given Text Id: '%s'; default widget without styling will be created!"), __LINE__, __FUNCTION__, *ItemTextId);
-	return FoundComboitemPtr ? *FoundComboitemPtr : nullptr;
+	ensureMsgf(FoundComboitem, TEXT("ASSERT: [%i] %hs:\nFailed to find the comboitem widget by the given Text Id: '%s'; default widget without styling will be created!"), __LINE__, __FUNCTION__, *ItemTextId);
+	return FoundComboitem;
 }
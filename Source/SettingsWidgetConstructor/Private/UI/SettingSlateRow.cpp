@@ -0,0 +1,385 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "UI/SettingSlateRow.h"
+//---
+#include "Data/SettingsDataAsset.h"
+#include "Data/SettingsStyleSet.h"
+#include "UI/SettingsWidget.h"
+//---
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SComboBox.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSlider.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingSlateRow)
+
+// Returns true if specified setting type is chosen in the Settings Data Asset to be shown by native Slate rows
+bool USettingSlateRow::IsSlateRowArchetype(ESettingArchetype Archetype)
+{
+	ESettingsSlateRowTypes SlateRowType = ESettingsSlateRowTypes::None;
+	switch (Archetype)
+	{
+		case ESettingArchetype::Button: SlateRowType = ESettingsSlateRowTypes::Button;
+			break;
+		case ESettingArchetype::Checkbox: SlateRowType = ESettingsSlateRowTypes::Checkbox;
+			break;
+		case ESettingArchetype::Combobox: SlateRowType = ESettingsSlateRowTypes::Combobox;
+			break;
+		case ESettingArchetype::Slider: SlateRowType = ESettingsSlateRowTypes::Slider;
+			break;
+		case ESettingArchetype::TextLine: SlateRowType = ESettingsSlateRowTypes::TextLine;
+			break;
+		case ESettingArchetype::UserInput: SlateRowType = ESettingsSlateRowTypes::UserInput;
+			break;
+		default: break;
+	}
+
+	return SlateRowType != ESettingsSlateRowTypes::None
+	       && EnumHasAnyFlags(USettingsDataAsset::Get().GetSlateRowTypes(), SlateRowType);
+}
+
+// Pushes the current value of the setting from its row into Slate widgets, while the setter is not called
+void USettingSlateRow::RefreshValue()
+{
+	const FSettingsPicker& SettingRow = GetSettingRow();
+	if (!SettingRow.IsValid())
+	{
+		return;
+	}
+
+	// Same as Blueprint sub-widgets, don't invalidate any Slate widget if it already shows this value
+	if (SlateCaptionInternal
+	    && !SlateCaptionInternal->GetText().EqualTo(SettingRow.PrimaryData.Caption))
+	{
+		SlateCaptionInternal->SetText(SettingRow.PrimaryData.Caption);
+	}
+
+	switch (ArchetypeInternal)
+	{
+		case ESettingArchetype::Checkbox:
+		{
+			const ECheckBoxState NewState = SettingRow.Checkbox.bIsSet ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+			if (SlateCheckboxInternal
+			    && SlateCheckboxInternal->GetCheckedState() != NewState)
+			{
+				SlateCheckboxInternal->SetIsChecked(NewState);
+			}
+			break;
+		}
+		case ESettingArchetype::Slider:
+		{
+			const float NewValue = static_cast<float>(SettingRow.Slider.ChosenValue);
+			if (SlateSliderInternal
+			    && !FMath::IsNearlyEqual(SlateSliderInternal->GetValue(), NewValue))
+			{
+				SlateSliderInternal->SetValue(NewValue);
+			}
+			break;
+		}
+		case ESettingArchetype::Combobox:
+		{
+			const FSettingsCombobox& ComboboxData = SettingRow.Combobox;
+			const bool bOptionsRefilled = RefreshComboboxOptions(ComboboxData.Members);
+			const TSharedPtr<FText> ChosenItem = ComboboxOptionsInternal.IsValidIndex(ComboboxData.ChosenMemberIndex) ? ComboboxOptionsInternal[ComboboxData.ChosenMemberIndex] : nullptr;
+			if (SlateComboboxInternal
+			    && (bOptionsRefilled || SlateComboboxInternal->GetSelectedItem() != ChosenItem))
+			{
+				SlateComboboxInternal->SetSelectedItem(ChosenItem);
+			}
+
+			const FText& ChosenText = ChosenItem ? *ChosenItem : FText::GetEmpty();
+			if (SlateComboboxTextInternal
+			    && !SlateComboboxTextInternal->GetText().EqualTo(ChosenText))
+			{
+				SlateComboboxTextInternal->SetText(ChosenText);
+			}
+			break;
+		}
+		case ESettingArchetype::UserInput:
+		{
+			const FText NewText = FText::FromName(SettingRow.UserInput.UserInput);
+			if (SlateEditableTextBoxInternal
+			    && !SlateEditableTextBoxInternal->GetText().EqualTo(NewText))
+			{
+				SlateEditableTextBoxInternal->SetText(NewText);
+			}
+			break;
+		}
+		default: break;
+	}
+}
+
+/*********************************************************************************************
+ * Events and overrides
+ ********************************************************************************************* */
+
+// Is overridden to return the chosen data of the setting row
+const FSettingsDataBase* USettingSlateRow::GetSettingData() const
+{
+	const FSettingsPicker& SettingRow = GetSettingRow();
+	return SettingRow.IsValid() ? SettingRow.GetChosenSettingsData() : nullptr;
+}
+
+// Is overridden to set the caption and combobox options again, since they are the same texts that have to be measured in the new culture
+void USettingSlateRow::RefreshTexts()
+{
+	Super::RefreshTexts();
+
+	const FSettingsPicker& SettingRow = GetSettingRow();
+	if (SlateCaptionInternal
+	    && SettingRow.IsValid())
+	{
+		SlateCaptionInternal->SetText(SettingRow.PrimaryData.Caption);
+	}
+
+	// Options are equal to members in any culture, so drop them to be refilled by the value refresh
+	ComboboxOptionsInternal.Reset();
+	RefreshValue();
+}
+
+// Is overridden to take the setting type before the row is built
+void USettingSlateRow::OnAddSetting(const FSettingsPicker& Setting)
+{
+	ArchetypeInternal = FSettingsRowStore::GetArchetypeByName(Setting.SettingsType);
+
+	Super::OnAddSetting(Setting);
+
+	RefreshValue();
+}
+
+// Is overridden to build the whole row from native Slate widgets instead of the widget tree
+TSharedRef<SWidget> USettingSlateRow::RebuildWidget()
+{
+	const FSettingsPicker& SettingRow = GetSettingRow();
+	if (!SettingRow.IsValid())
+	{
+		return Super::RebuildWidget();
+	}
+
+	if (ArchetypeInternal == ESettingArchetype::None)
+	{
+		ArchetypeInternal = FSettingsRowStore::GetArchetypeByName(SettingRow.SettingsType);
+	}
+
+	const FSettingsStyleSet& StyleSet = FSettingsStyleSet::Get();
+	const FSettingsPrimary& PrimaryData = SettingRow.PrimaryData;
+
+	SlateCaptionInternal = SNew(STextBlock)
+		.TextStyle(&StyleSet.GetCaptionTextStyle())
+		.Text(PrimaryData.Caption);
+
+	TSharedRef<SWidget> RowContent = SNullWidget::NullWidget;
+	if (ArchetypeInternal == ESettingArchetype::Button)
+	{
+		// The whole row is the button with its caption inside
+		RowContent = SAssignNew(SlateButtonInternal, SButton)
+			.ButtonStyle(&StyleSet.GetButtonStyle())
+			.ClickMethod(EButtonClickMethod::PreciseClick)
+			.HAlign(HAlign_Center)
+			.VAlign(VAlign_Center)
+			.OnClicked_UObject(this, &ThisClass::OnButtonClicked)
+			[
+				SlateCaptionInternal.ToSharedRef()
+			];
+	}
+	else
+	{
+		RowContent = SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			[
+				SlateCaptionInternal.ToSharedRef()
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			[
+				BuildValueWidget(SettingRow)
+			];
+	}
+
+	return SAssignNew(SlateSizeBoxInternal, SBox)
+		.MinDesiredHeight(PrimaryData.LineHeight)
+		[
+			RowContent
+		];
+}
+
+// Releases all Slate widgets of this row
+void USettingSlateRow::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	SlateSizeBoxInternal.Reset();
+	SlateCaptionInternal.Reset();
+	SlateButtonInternal.Reset();
+	SlateCheckboxInternal.Reset();
+	SlateSliderInternal.Reset();
+	SlateComboboxInternal.Reset();
+	SlateComboboxTextInternal.Reset();
+	ComboboxOptionsInternal.Empty();
+	SlateEditableTextBoxInternal.Reset();
+}
+
+// Returns the Slate widget that shows the value of specified setting, or null widget if the type has no value
+TSharedRef<SWidget> USettingSlateRow::BuildValueWidget(const FSettingsPicker& Setting)
+{
+	const FSettingsStyleSet& StyleSet = FSettingsStyleSet::Get();
+
+	switch (ArchetypeInternal)
+	{
+		case ESettingArchetype::Checkbox:
+			return SAssignNew(SlateCheckboxInternal, SCheckBox)
+				.Style(&StyleSet.GetCheckboxStyle())
+				.IsChecked(Setting.Checkbox.bIsSet ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+				.OnCheckStateChanged_UObject(this, &ThisClass::OnCheckStateChanged);
+		case ESettingArchetype::Slider:
+			return SAssignNew(SlateSliderInternal, SSlider)
+				.Style(&StyleSet.GetSliderStyle())
+				.Value(static_cast<float>(Setting.Slider.ChosenValue))
+				.OnValueChanged_UObject(this, &ThisClass::OnSliderValueChanged)
+				.OnMouseCaptureEnd_UObject(this, &ThisClass::OnSliderMouseCaptureEnd);
+		case ESettingArchetype::Combobox:
+		{
+			RefreshComboboxOptions(Setting.Combobox.Members);
+			const int32 ChosenIndex = Setting.Combobox.ChosenMemberIndex;
+			const TSharedPtr<FText> ChosenItem = ComboboxOptionsInternal.IsValidIndex(ChosenIndex) ? ComboboxOptionsInternal[ChosenIndex] : nullptr;
+			return SAssignNew(SlateComboboxInternal, SComboboxText)
+				.ComboBoxStyle(&StyleSet.GetComboboxStyle())
+				.OptionsSource(&ComboboxOptionsInternal)
+				.InitiallySelectedItem(ChosenItem)
+				.OnGenerateWidget_UObject(this, &ThisClass::OnGenerateComboitem)
+				.OnSelectionChanged_UObject(this, &ThisClass::OnComboboxSelectionChanged)
+				.OnComboBoxOpening_UObject(this, &ThisClass::OnComboboxOpening)
+				[
+					SAssignNew(SlateComboboxTextInternal, STextBlock)
+					.TextStyle(&StyleSet.GetElementTextStyle())
+					.Justification(Setting.Combobox.TextJustify)
+					.Text(ChosenItem ? *ChosenItem : FText::GetEmpty())
+				];
+		}
+		case ESettingArchetype::UserInput:
+			return SAssignNew(SlateEditableTextBoxInternal, SEditableTextBox)
+				.Style(&StyleSet.GetUserInputStyle())
+				.Text(FText::FromName(Setting.UserInput.UserInput))
+				.OnTextChanged_UObject(this, &ThisClass::OnUserInputChanged);
+		default:
+			// Text line shows only its caption
+			return SNullWidget::NullWidget;
+	}
+}
+
+// Refills combobox options if its members are changed, returns true if options were refilled
+bool USettingSlateRow::RefreshComboboxOptions(const TArray<FText>& Members)
+{
+	bool bIsSame = ComboboxOptionsInternal.Num() == Members.Num();
+	for (int32 Index = 0; bIsSame && Index < Members.Num(); ++Index)
+	{
+		bIsSame = ComboboxOptionsInternal[Index] && ComboboxOptionsInternal[Index]->EqualTo(Members[Index]);
+	}
+
+	if (bIsSame)
+	{
+		return false;
+	}
+
+	ComboboxOptionsInternal.Reset(Members.Num());
+	for (const FText& MemberIt : Members)
+	{
+		ComboboxOptionsInternal.Emplace(MakeShared<FText>(MemberIt));
+	}
+
+	if (SlateComboboxInternal)
+	{
+		SlateComboboxInternal->RefreshOptions();
+	}
+
+	return true;
+}
+
+// Called when the button is pressed
+FReply USettingSlateRow::OnButtonClicked()
+{
+	if (SettingsWidgetInternal)
+	{
+		SettingsWidgetInternal->SetSettingButtonPressed(GetSettingTag());
+	}
+
+	return FReply::Handled();
+}
+
+// Called when the checked state has changed
+void USettingSlateRow::OnCheckStateChanged(ECheckBoxState NewState)
+{
+	if (SettingsWidgetInternal)
+	{
+		SettingsWidgetInternal->SetSettingCheckbox(GetSettingTag(), NewState == ECheckBoxState::Checked);
+	}
+}
+
+// Called when the value is changed by slider
+void USettingSlateRow::OnSliderValueChanged(float NewValue)
+{
+	if (SettingsWidgetInternal)
+	{
+		SettingsWidgetInternal->SetSettingSlider(GetSettingTag(), NewValue);
+	}
+}
+
+// Invoked when the mouse is released and a capture ends
+void USettingSlateRow::OnSliderMouseCaptureEnd()
+{
+	// Play the sound
+	if (SettingsWidgetInternal)
+	{
+		SettingsWidgetInternal->PlayUIClickSFX();
+	}
+}
+
+// Called when a new member is selected in the combobox
+void USettingSlateRow::OnComboboxSelectionChanged(TSharedPtr<FText> SelectedItem, ESelectInfo::Type SelectionType)
+{
+	if (!SettingsWidgetInternal
+	    || SelectionType == ESelectInfo::Direct)
+	{
+		// Is selected by code when the value is refreshed, so there is nothing to set
+		return;
+	}
+
+	const int32 SelectedIndex = ComboboxOptionsInternal.IndexOfByKey(SelectedItem);
+	SettingsWidgetInternal->SetSettingComboboxIndex(GetSettingTag(), SelectedIndex);
+}
+
+// Called when the combobox is opened
+void USettingSlateRow::OnComboboxOpening()
+{
+	// Play the sound
+	if (SettingsWidgetInternal)
+	{
+		SettingsWidgetInternal->PlayUIClickSFX();
+	}
+}
+
+// Returns the widget of specified member in the opened combobox
+TSharedRef<SWidget> USettingSlateRow::OnGenerateComboitem(TSharedPtr<FText> InItem) const
+{
+	const FSettingsPicker& SettingRow = GetSettingRow();
+	return SNew(STextBlock)
+		.TextStyle(&FSettingsStyleSet::Get().GetElementTextStyle())
+		.Justification(SettingRow.Combobox.TextJustify)
+		.Text(InItem ? *InItem : FText::GetEmpty());
+}
+
+// Called whenever the text is changed interactively by the user
+void USettingSlateRow::OnUserInputChanged(const FText& Text)
+{
+	if (SettingsWidgetInternal)
+	{
+		SettingsWidgetInternal->SetSettingUserInput(GetSettingTag(), FName(Text.ToString()));
+	}
+}
@@ -4,6 +4,7 @@
 //---
 #include "Data/SettingsDataAsset.h"
 #include "MyUtilsLibraries/SWCWidgetUtilsLibrary.h"
+#include "MyUtilsLibraries/SettingsUtilsLibrary.h"
 #include "UI/SettingsWidget.h"
 //---
 #include "Components/Button.h"
@@ -22,10 +23,40 @@
 //---
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SettingSubWidget)
 
-// Set the new setting tag for this widget
+// Returns the row of this widget from the row store of the Settings Widget, is empty if the row is not found
+const FSettingsPicker& USettingSubWidget::GetSettingRow() const
+{
+	const USettingsWidget* SettingsWidget = GetSettingsWidget();
+	return SettingsWidget ? SettingsWidget->GetSettingRowByHandle(SettingHandleInternal) : FSettingsPicker::Empty;
+}
+
+// Returns the setting primary row of this widget, is taken from the row store of the Settings Widget
+const FSettingsPrimary& USettingSubWidget::GetSettingPrimaryRow() const
+{
+	// Row might be not found if this widget is not added by the Settings Widget, e.g: the shared tooltip
+	const FSettingsPicker& SettingRow = GetSettingRow();
+	return SettingRow.IsValid() ? SettingRow.PrimaryData : PrimaryDataInternal;
+}
+
+// Set the new setting tag for this widget and resolves the handle of its row
 void USettingSubWidget::SetSettingPrimaryRow(const FSettingsPrimary& InSettingPrimaryRow)
 {
+	SettingTagInternal = InSettingPrimaryRow.Tag;
+
+	// Row is searched by its tag only here, next accesses go through the handle
+	const USettingsWidget* SettingsWidget = GetSettingsWidget();
+	SettingHandleInternal = SettingsWidget ? SettingsWidget->ResolveSettingHandle(SettingTagInternal) : FSettingHandle::EmptyHandle;
+
+	// Blueprint view doesn't need the owner functions list, it's used only to bind the setting
 	PrimaryDataInternal = InSettingPrimaryRow;
+	PrimaryDataInternal.OwnerFunctionList.Reset();
+}
+
+// Returns the mutable row of this widget from the row store of the Settings Widget, is used to set the setting data
+FSettingsPicker* USettingSubWidget::GetSettingRowMutable() const
+{
+	USettingsWidget* SettingsWidget = GetSettingsWidget();
+	return SettingsWidget ? SettingsWidget->GetSettingRowMutableByHandle(SettingHandleInternal) : nullptr;
 }
 
 // Returns the main setting widget (the outer of this subwidget)
@@ -101,18 +132,37 @@ UPanelSlot* USettingSubWidget::Attach()
 // Adds given widget as tooltip to this setting
 void USettingSubWidget::AddTooltipWidget()
 {
-	if (PrimaryDataInternal.Tooltip.IsEmpty()
-		|| PrimaryDataInternal.Tooltip.EqualToCaseIgnored(FCoreTexts::Get().None))
+	const FText& Tooltip = GetSettingPrimaryRow().Tooltip;
+	if (Tooltip.IsEmpty()
+		|| Tooltip.EqualToCaseIgnored(FCoreTexts::Get().None))
 	{
 		return;
 	}
 
-	USettingTooltip* CreatedWidget = CreateWidget<USettingTooltip>(GetOwningPlayer(), USettingsDataAsset::Get().GetTooltipClass());
-	checkf(CreatedWidget, TEXT("ERROR: [%i] %s:\n'CreatedWidget' is null!"), __LINE__, *FString(__FUNCTION__));
+	// Don't create own tooltip widget, but take the shared one on hover
+	ToolTipWidgetDelegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(ThisClass, OnGetSharedTooltip));
+}
+
+// Is called on hover to return the shared tooltip widget filled with the tooltip text of this setting
+UWidget* USettingSubWidget::OnGetSharedTooltip()
+{
+	USettingsWidget* SettingsWidget = GetSettingsWidget();
+	USettingTooltip* SharedTooltip = SettingsWidget ? SettingsWidget->GetSharedTooltip() : nullptr;
+	if (!SharedTooltip)
+	{
+		return nullptr;
+	}
+
+	if (SharedTooltip->GetSettingTag() != GetSettingTag())
+	{
+		// Another setting was hovered before, so refresh the text
+		const FSettingsPrimary& PrimaryRow = GetSettingPrimaryRow();
+		SharedTooltip->SetSettingPrimaryRow(PrimaryRow);
+		SharedTooltip->SetToolTipText(PrimaryRow.Tooltip);
+		SharedTooltip->ApplyTheme();
+	}
 
-	SetToolTip(CreatedWidget);
-	CreatedWidget->SetToolTipText(PrimaryDataInternal.Tooltip);
-	CreatedWidget->ApplyTheme();
+	return SharedTooltip;
 }
 
 // Base method that is called when the underlying slate widget is constructed
@@ -127,6 +177,12 @@ void USettingSubWidget::OnAddSetting(const FSettingsPicker& Setting)
 	ApplyTheme();
 }
 
+// Base method that updates texts shown by this widget in place, is called after the culture is changed
+void USettingSubWidget::RefreshTexts()
+{
+	SetCaptionText(GetSettingPrimaryRow().Caption);
+}
+
 // Returns the custom line height for this setting
 float USettingSubWidget::GetLineHeight() const
 {
@@ -160,10 +216,22 @@ void USettingSubWidget::SetCaptionText(const FText& NewCaptionText)
 	}
 }
 
+// Returns the button setting data
+const FSettingsButton& USettingButton::GetButtonData() const
+{
+	const FSettingsPicker& SettingRow = GetSettingRow();
+	return SettingRow.IsValid() ? SettingRow.Button : ButtonDataInternal;
+}
+
 // Set the new button setting data for this widget
 void USettingButton::SetButtonData(const FSettingsButton& InButtonData)
 {
 	ButtonDataInternal = InButtonData;
+
+	if (FSettingsPicker* SettingRow = GetSettingRowMutable())
+	{
+		SettingRow->Button = InButtonData;
+	}
 }
 
 // Called after the underlying slate widget is constructed
@@ -203,15 +271,22 @@ void USettingButton::OnButtonPressed()
 // Set the new checkbox setting data for this widget
 void USettingCheckbox::SetCheckboxData(const FSettingsCheckbox& InCheckboxData)
 {
-	CheckboxDataInternal = InCheckboxData;
+	FSettingsPicker* SettingRow = GetSettingRowMutable();
+	if (ensureMsgf(SettingRow, TEXT("ASSERT: [%i] %hs:\n'%s' setting is not found in the Settings Widget, the data can't be set!"), __LINE__, __FUNCTION__, *SettingTagInternal.ToString()))
+	{
+		SettingRow->Checkbox = InCheckboxData;
+	}
 }
 
 // Internal function to change the value of this subwidget
 void USettingCheckbox::SetCheckboxValue(bool InValue)
 {
-	if (ensureMsgf(CheckboxWidget, TEXT("ASSERT: [%i] %hs:\n'CheckboxWidget' condition is FALSE"), __LINE__, __FUNCTION__))
+	const ECheckBoxState NewState = InValue ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+	if (ensureMsgf(CheckboxWidget, TEXT("ASSERT: [%i] %hs:\n'CheckboxWidget' condition is FALSE"), __LINE__, __FUNCTION__)
+	    && CheckboxWidget->GetCheckedState() != NewState)
 	{
-		CheckboxWidget->SetCheckedState(InValue ? ECheckBoxState::Checked : ECheckBoxState::Unchecked);
+		// Don't invalidate the checkbox if it already shows this value, e.g: when it's toggled by the player
+		CheckboxWidget->SetCheckedState(NewState);
 	}
 
 	K2_OnSetCheckboxValue(InValue);
@@ -245,22 +320,26 @@ void USettingCheckbox::OnCheckStateChanged_Implementation(bool bIsChecked)
 // Is overridden to construct the checkbox
 void USettingCheckbox::OnAddSetting(const FSettingsPicker& Setting)
 {
-	CheckboxDataInternal = Setting.Checkbox;
-
 	Super::OnAddSetting(Setting);
 }
 
 // Set the new slider setting data for this widget
 void USettingSlider::SetSliderData(const FSettingsSlider& InSliderData)
 {
-	SliderDataInternal = InSliderData;
+	FSettingsPicker* SettingRow = GetSettingRowMutable();
+	if (ensureMsgf(SettingRow, TEXT("ASSERT: [%i] %hs:\n'%s' setting is not found in the Settings Widget, the data can't be set!"), __LINE__, __FUNCTION__, *SettingTagInternal.ToString()))
+	{
+		SettingRow->Slider = InSliderData;
+	}
 }
 
 // Internal function to change the value of this subwidget
 void USettingSlider::SetSliderValue(double InValue)
 {
-	if (ensureMsgf(SliderWidget, TEXT("ERROR: [%i] %hs:\n'SliderWidget' is null!"), __LINE__, __FUNCTION__))
+	if (ensureMsgf(SliderWidget, TEXT("ERROR: [%i] %hs:\n'SliderWidget' is null!"), __LINE__, __FUNCTION__)
+	    && !FMath::IsNearlyEqual(SliderWidget->GetValue(), InValue))
 	{
+		// Don't invalidate the slider if it already shows this value, e.g: when it's dragged by the player
 		SliderWidget->SetValue(InValue);
 	}
 
@@ -306,15 +385,25 @@ void USettingSlider::OnValueChanged(float Value)
 // Is overridden to construct the slider
 void USettingSlider::OnAddSetting(const FSettingsPicker& Setting)
 {
-	SliderDataInternal = Setting.Slider;
-
 	Super::OnAddSetting(Setting);
 }
 
+// Returns the Text Line setting data
+const FSettingsTextLine& USettingTextLine::GetTextLineData() const
+{
+	const FSettingsPicker& SettingRow = GetSettingRow();
+	return SettingRow.IsValid() ? SettingRow.TextLine : TextLineDataInternal;
+}
+
 // Set the new Text Line setting data for this widget
 void USettingTextLine::SetTextLineData(const FSettingsTextLine& InTextLineData)
 {
 	TextLineDataInternal = InTextLineData;
+
+	if (FSettingsPicker* SettingRow = GetSettingRowMutable())
+	{
+		SettingRow->TextLine = InTextLineData;
+	}
 }
 
 // Is overridden to construct the text line
@@ -337,7 +426,11 @@ void USettingUserInput::GetEditableText(FText& OutText) const
 // Set the new user input setting data for this widget
 void USettingUserInput::SetUserInputData(const FSettingsUserInput& InUserInputData)
 {
-	UserInputDataInternal = InUserInputData;
+	FSettingsPicker* SettingRow = GetSettingRowMutable();
+	if (ensureMsgf(SettingRow, TEXT("ASSERT: [%i] %hs:\n'%s' setting is not found in the Settings Widget, the data can't be set!"), __LINE__, __FUNCTION__, *SettingTagInternal.ToString()))
+	{
+		SettingRow->UserInput = InUserInputData;
+	}
 }
 
 // Internal function to change the value of this subwidget
@@ -383,22 +476,22 @@ void USettingUserInput::OnTextChanged(const FText& Text)
 // Is overridden to construct the user input
 void USettingUserInput::OnAddSetting(const FSettingsPicker& Setting)
 {
-	UserInputDataInternal = Setting.UserInput;
-
 	Super::OnAddSetting(Setting);
 }
 
 // Set the new custom widget setting data for this widget
 void USettingCustomWidget::SetCustomWidgetData(const FSettingsCustomWidget& InCustomWidgetData)
 {
-	CustomWidgetDataInternal = InCustomWidgetData;
+	FSettingsPicker* SettingRow = GetSettingRowMutable();
+	if (ensureMsgf(SettingRow, TEXT("ASSERT: [%i] %hs:\n'%s' setting is not found in the Settings Widget, the data can't be set!"), __LINE__, __FUNCTION__, *SettingTagInternal.ToString()))
+	{
+		SettingRow->CustomWidget = InCustomWidgetData;
+	}
 }
 
 // Is overridden to construct the custom widget
 void USettingCustomWidget::OnAddSetting(const FSettingsPicker& Setting)
 {
-	CustomWidgetDataInternal = Setting.CustomWidget;
-
 	Super::OnAddSetting(Setting);
 }
 
@@ -428,3 +521,11 @@ void USettingColumn::NativeConstruct()
 		check(SlateScrollBoxInternal.IsValid());
 	}
 }
+
+// Is overridden to wrap the column into own invalidation root, so change of any setting repaints only its column
+TSharedRef<SWidget> USettingColumn::RebuildWidget()
+{
+	const USettingsWidget* SettingsWidget = GetSettingsWidget();
+	const ESettingsInvalidationMode InvalidationMode = SettingsWidget ? SettingsWidget->GetInvalidationMode() : USettingsDataAsset::Get().GetInvalidationMode();
+	return USettingsUtilsLibrary::WrapInvalidationRoot(Super::RebuildWidget(), InvalidationMode, GetFName());
+}
@@ -4,9 +4,19 @@
 
 // SWC
 #include "Data/SettingsDataAsset.h"
+#include "Data/SettingsDataTable.h"
+#include "Data/SettingsEngine.h"
+#include "Data/SettingsSharedCatalog.h"
+#include "Data/SettingsStyleSet.h"
+#include "Data/SettingsTextCache.h"
 #include "MyUtilsLibraries/SWCWidgetUtilsLibrary.h"
 #include "MyUtilsLibraries/SettingsUtilsLibrary.h"
+#include "Profiling/SettingsLatencyProfiler.h"
+#include "SettingsWidgetConstructorStats.h"
+#include "Subsystems/SettingsCatalogSubsystem.h"
+#include "Subsystems/SettingsWidgetSubsystem.h"
 #include "UI/SettingCombobox.h"
+#include "UI/SettingSlateRow.h"
 #include "UI/SettingSubWidget.h"
 
 // UE
@@ -18,7 +28,11 @@
 #include "Engine/Engine.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/Texture.h"
+#include "Framework/Application/SlateApplication.h"
 #include "GameFramework/GameUserSettings.h"
+#include "Misc/CoreDelegates.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -41,7 +55,7 @@ const FSettingsPicker& USettingsWidget::FindSettingRow(FName PotentialTagName) c
 
 	// Find row by specified substring
 	const FString TagSubString(PotentialTagName.ToString());
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsEngineInternal.GetRows())
 	{
 		const FString TagStringIt(RowIt.Key.ToString());
 		if (TagStringIt.Contains(TagSubString))
@@ -62,107 +76,184 @@ const FSettingsPicker& USettingsWidget::GetSettingRow(const FSettingTag& Setting
 		return FSettingsPicker::Empty;
 	}
 
-	const FSettingsPicker* FoundRow = SettingsTableRowsInternal.Find(SettingTag.GetTagName());
+	const FSettingsPicker* FoundRow = SettingsEngineInternal.GetRows().Find(SettingTag.GetTagName());
 	return FoundRow ? *FoundRow : FSettingsPicker::Empty;
 }
 
+// Returns the handle of the setting by specified tag, is resolved once and then used instead of the tag to avoid the lookup on each call
+FSettingHandle USettingsWidget::ResolveSettingHandle(const FSettingTag& SettingTag) const
+{
+	return SettingTag.IsValid() ? SettingsEngineInternal.GetRowStore().MakeHandle(SettingTag.GetTagName()) : FSettingHandle::EmptyHandle;
+}
+
+// Returns true if specified handle still points to its setting, is false once settings are rebuilt or removed
+bool USettingsWidget::IsSettingHandleValid(const FSettingHandle& SettingHandle) const
+{
+	return SettingsEngineInternal.GetRowStore().ResolveHandle(SettingHandle) != INDEX_NONE;
+}
+
+// Returns the found row by specified handle or empty row if the handle is stale
+const FSettingsPicker& USettingsWidget::GetSettingRowByHandle(const FSettingHandle& SettingHandle) const
+{
+	const FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	const int32 RowIndex = RowStore.ResolveHandle(SettingHandle);
+	return RowIndex != INDEX_NONE ? RowStore.GetRow(RowIndex) : FSettingsPicker::Empty;
+}
+
+// Returns the mutable row by specified tag, is used by sub-widgets to set their data in the single row store
+FSettingsPicker* USettingsWidget::GetSettingRowMutable(const FSettingTag& SettingTag)
+{
+	return SettingTag.IsValid() ? SettingsEngineInternal.GetRows().Find(SettingTag.GetTagName()) : nullptr;
+}
+
+// Returns the mutable row by specified handle or null if the handle is stale
+FSettingsPicker* USettingsWidget::GetSettingRowMutableByHandle(const FSettingHandle& SettingHandle)
+{
+	FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	const int32 RowIndex = RowStore.ResolveHandle(SettingHandle);
+	return RowIndex != INDEX_NONE ? &RowStore.GetRow(RowIndex) : nullptr;
+}
+
 // Save all settings into their configs
 void USettingsWidget::SaveSettings()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::SaveSettings);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_SaveSettings);
+
 	ApplySettings();
 
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
-	{
-		if (UObject* ContextObject = RowIt.Value.PrimaryData.GetSettingOwner(this))
-		{
-			ContextObject->SaveConfig();
-		}
-	}
+	FSettingsEngine::SaveOwners(SettingsEngineInternal.GetRowStore(), this);
 }
 
 // Apply all current settings on device
 void USettingsWidget::ApplySettings()
 {
-	UGameUserSettings* GameUserSettings = USettingsUtilsLibrary::GetGameUserSettings();
-	if (!GameUserSettings)
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::ApplySettings);
+
+	// Everything is applied now, so pending apply is not needed anymore, also when there is nothing to apply
+	ClearPendingApplySettings();
+
+	SettingsEngineInternal.ApplySettings();
+}
+
+// Requests to apply current settings on device at the end of this frame
+void USettingsWidget::ApplySettingsDeferred(bool bApplyResolution/* = true*/)
+{
+	bPendingApplyResolutionInternal |= bApplyResolution;
+
+	if (bPendingApplySettingsInternal)
 	{
+		// Is already requested during this frame
 		return;
 	}
 
-	constexpr bool bCheckForCommandLineOverrides = false;
-	GameUserSettings->ApplySettings(bCheckForCommandLineOverrides);
+	bPendingApplySettingsInternal = true;
+	FCoreDelegates::OnEndFrame.AddUObject(this, &ThisClass::OnEndFrameApplySettings);
 }
 
 // Update settings on UI
 void USettingsWidget::UpdateSettingsByTags(const FGameplayTagContainer& SettingsToUpdate, bool bLoadFromConfig /* = false*/)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::UpdateSettingsByTags);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_UpdateSettingsByTags);
+
 	if (SettingsToUpdate.IsEmpty()
 	    || !SettingsToUpdate.IsValidIndex(0))
 	{
 		return;
 	}
 
-	if (SettingsTableRowsInternal.IsEmpty())
+	if (SettingsEngineInternal.GetRows().IsEmpty())
 	{
 		CacheTable();
 	}
 
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	TArray<int32> RowIndices;
+	SettingsEngineInternal.GetRowStore().FindIndicesByTags(SettingsToUpdate, /*Out*/ RowIndices);
+	SettingsEngineInternal.RefreshSettings(RowIndices, bLoadFromConfig);
+}
+
+// Update all existing settings on UI
+void USettingsWidget::UpdateAllSettings(bool bLoadFromConfig)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::UpdateAllSettings);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_UpdateSettingsByTags);
+
+	const int32 RowsNum = SettingsEngineInternal.Num();
+	TArray<int32> RowIndices;
+	RowIndices.Reserve(RowsNum);
+	for (int32 RowIndex = 0; RowIndex < RowsNum; ++RowIndex)
 	{
-		const FSettingsPicker& Setting = RowIt.Value;
-		const FSettingTag& SettingTag = Setting.PrimaryData.Tag;
-		if (!SettingTag.IsValid()
-		    || !SettingTag.MatchesAny(SettingsToUpdate))
-		{
-			continue;
-		}
+		RowIndices.Emplace(RowIndex);
+	}
+	SettingsEngineInternal.RefreshSettings(RowIndices, bLoadFromConfig);
+}
 
-		FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
-		if (!ChosenData
-		    || !ChosenData->CanUpdateSetting())
-		{
-			continue;
-		}
+// Update all settings on UI that depend on specified setting, are taken from its 'Settings To Update'
+void USettingsWidget::UpdateDependentSettings(const FSettingTag& SettingTag)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::UpdateDependentSettings);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_UpdateSettingsByTags);
 
-		UObject* Owner = Setting.PrimaryData.GetSettingOwner(this);
-		if (!Owner)
-		{
-			continue;
-		}
+	const int32 RowIndex = SettingTag.IsValid() ? SettingsEngineInternal.GetRowStore().FindIndex(SettingTag.GetTagName()) : INDEX_NONE;
+	SettingsEngineInternal.RefreshDependencies(RowIndex);
+}
 
-		if (bLoadFromConfig)
-		{
-			// Obtain the latest value from configs and set it
-			Owner->LoadConfig();
-		}
+// Notifies that the value of specified setting was changed outside of the Settings Widget, e.g: by its owner
+void USettingsWidget::NotifySettingChanged(const FSettingTag& SettingTag)
+{
+	const int32 RowIndex = SettingTag.IsValid() ? SettingsEngineInternal.GetRowStore().FindIndex(SettingTag.GetTagName()) : INDEX_NONE;
+	if (RowIndex == INDEX_NONE)
+	{
+		return;
+	}
 
-		FString Result;
-		ChosenData->GetSettingValue(*this, SettingTag, /*Out*/ Result);
-		ChosenData->SetSettingValue(*this, SettingTag, Result);
+	if (IsVisible())
+	{
+		// Settings are shown, so update it right away
+		SettingsEngineInternal.RefreshSettings(MakeArrayView(&RowIndex, 1));
+		return;
 	}
+
+	DirtyRowIndicesInternal.AddUnique(RowIndex);
 }
 
-// Update all existing settings on UI
-void USettingsWidget::UpdateAllSettings(bool bLoadFromConfig)
+// Notifies that all settings might be changed outside of the Settings Widget, e.g: their configs are reloaded
+void USettingsWidget::NotifyAllSettingsChanged()
 {
-	FGameplayTagContainer AllSettingTags;
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	bAllSettingsDirtyInternal = true;
+	DirtyRowIndicesInternal.Reset();
+}
+
+// Refreshes settings on UI when the widget is opened according to the refresh policy
+void USettingsWidget::RefreshSettingsOnOpen()
+{
+	if (bAllSettingsDirtyInternal
+	    || USettingsDataAsset::Get().GetOpenRefreshPolicy() == ESettingsRefreshPolicy::FullRefresh)
 	{
-		AllSettingTags.AddTagFast(RowIt.Value.PrimaryData.Tag);
+		UpdateAllSettings();
 	}
-	UpdateSettingsByTags(AllSettingTags, bLoadFromConfig);
+	else
+	{
+		// Update settings in their order, since each might depend on previous ones
+		DirtyRowIndicesInternal.Sort();
+		SettingsEngineInternal.RefreshSettings(DirtyRowIndicesInternal);
+	}
+
+	DirtyRowIndicesInternal.Reset();
+	bAllSettingsDirtyInternal = false;
 }
 
 // Returns the name of found tag by specified function
 const FSettingTag& USettingsWidget::GetTagByFunction(const FSettingFunctionPicker& SettingFunction) const
 {
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	const FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	for (int32 RowIndex = 0; RowIndex < RowStore.Num(); ++RowIndex)
 	{
-		const FSettingsPrimary& PrimaryData = RowIt.Value.PrimaryData;
-		if (PrimaryData.Getter == SettingFunction
-		    || PrimaryData.Setter == SettingFunction)
+		if (RowStore.GetGetter(RowIndex) == SettingFunction
+		    || RowStore.GetSetter(RowIndex) == SettingFunction)
 		{
-			return PrimaryData.Tag;
+			return RowStore.GetTag(RowIndex);
 		}
 	}
 
@@ -182,318 +273,466 @@ void USettingsWidget::SetSettingValue(FName TagName, const FString& Value)
 		return;
 	}
 
-	FSettingsDataBase* ChosenData = FoundRow.GetChosenSettingsData();
-	if (!ChosenData)
-	{
-		return;
-	}
-
 	const FSettingTag& Tag = FoundRow.PrimaryData.Tag;
 	if (Tag.IsValid())
 	{
-		ChosenData->SetSettingValue(*this, Tag, Value);
-	}
-}
-
-/** Executes the common pattern of setting a value, executing if bound, and updating the settings.
- * @param Tag The tag used to find the setting row.
- * @param DataMember The member that holds the desired value.
- * @param MemberValue The specific member to set the value to.
- * @param Value The new value to set.
- * @param SetterExpression The expression to update the setter delegate. */
-#define SET_SETTING_VALUE(Tag, DataMember, MemberValue, Value, SetterExpression)         \
-	do                                                                                   \
-	{                                                                                    \
-		if (!Tag.IsValid())                                                              \
-		{                                                                                \
-			return;                                                                      \
-		}                                                                                \
-		FSettingsPicker* FoundRowPtr = SettingsTableRowsInternal.Find(Tag.GetTagName()); \
-		if (!FoundRowPtr)                                                                \
-		{                                                                                \
-			return;                                                                      \
-		}                                                                                \
-		auto& Data = FoundRowPtr->DataMember;                                            \
-		if (Data.MemberValue == Value)                                                   \
-		{                                                                                \
-			return;                                                                      \
-		}                                                                                \
-		Data.MemberValue = Value;                                                        \
-		Data.SetterExpression.ExecuteIfBound(Value);                                     \
-		UpdateSettingsByTags(FoundRowPtr->PrimaryData.SettingsToUpdate);                 \
-	} while (0)
+		SettingsEngineInternal.WriteRowValue(SettingsEngineInternal.GetRowStore().FindIndex(Tag.GetTagName()), Value);
+	}
+}
+
+/** Resolves the row by specified handle and declares its 'RowIndex', returns if the handle is stale.
+ * @param Handle The handle used to find the setting row. */
+#define RESOLVE_SETTING_HANDLE(Handle)                                                 \
+	const int32 RowIndex = SettingsEngineInternal.GetRowStore().ResolveHandle(Handle); \
+	if (RowIndex == INDEX_NONE)                                                        \
+	{                                                                                  \
+		return;                                                                        \
+	}
 
 // Press button
 void USettingsWidget::SetSettingButtonPressed(const FSettingTag& ButtonTag)
 {
-	if (!ButtonTag.IsValid())
+	SetSettingButtonPressedByHandle(ResolveSettingHandle(ButtonTag));
+}
+
+// Press button by specified handle
+void USettingsWidget::SetSettingButtonPressedByHandle(const FSettingHandle& ButtonHandle)
+{
+	RESOLVE_SETTING_HANDLE(ButtonHandle)
+
+	SettingsEngineInternal.WriteRow(RowIndex, [](FSettingsPicker& Row)
 	{
-		return;
-	}
+		FSettingsEngine::PressButton(Row);
+		return ESettingWriteResult::Changed;
+	});
 
-	const FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(ButtonTag.GetTagName());
-	if (!SettingsRowPtr)
+	if (!IsSettingsBatchActive())
 	{
-		return;
+		PlayUIClickSFX();
 	}
-
-	SettingsRowPtr->Button.OnButtonPressed.ExecuteIfBound();
-
-	UpdateSettingsByTags(SettingsRowPtr->PrimaryData.SettingsToUpdate);
-
-	OnAnySettingSet(SettingsRowPtr->PrimaryData);
-
-	PlayUIClickSFX();
 }
 
 // Toggle checkbox
 void USettingsWidget::SetSettingCheckbox(const FSettingTag& CheckboxTag, bool InValue)
 {
-	SET_SETTING_VALUE(CheckboxTag, Checkbox, bIsSet, InValue, OnSetterBool);
+	SetSettingCheckboxByHandle(ResolveSettingHandle(CheckboxTag), InValue);
+}
+
+// Toggle checkbox by specified handle
+void USettingsWidget::SetSettingCheckboxByHandle(const FSettingHandle& CheckboxHandle, bool InValue)
+{
+	RESOLVE_SETTING_HANDLE(CheckboxHandle)
 
-	if (USettingCheckbox* SettingCheckbox = GetSettingSubWidget<USettingCheckbox>(CheckboxTag))
+	const ESettingWriteResult WriteResult = SettingsEngineInternal.WriteRow(RowIndex, [InValue](FSettingsPicker& Row)
 	{
-		SettingCheckbox->SetCheckboxValue(InValue);
-		OnAnySettingSet(SettingCheckbox->GetSettingPrimaryRow());
-	}
+		return FSettingsEngine::SetCheckboxValue(Row, InValue);
+	});
 
-	PlayUIClickSFX();
+	if (WriteResult == ESettingWriteResult::Changed
+	    && !IsSettingsBatchActive())
+	{
+		PlayUIClickSFX();
+	}
 }
 
 // Set chosen member index for a combobox
 void USettingsWidget::SetSettingComboboxIndex(const FSettingTag& ComboboxTag, int32 InValue)
 {
-	if (InValue == INDEX_NONE)
-	{
-		return;
-	}
+	SetSettingComboboxIndexByHandle(ResolveSettingHandle(ComboboxTag), InValue);
+}
 
-	SET_SETTING_VALUE(ComboboxTag, Combobox, ChosenMemberIndex, InValue, OnSetterInt);
+// Set chosen member index for a combobox by specified handle
+void USettingsWidget::SetSettingComboboxIndexByHandle(const FSettingHandle& ComboboxHandle, int32 InValue)
+{
+	RESOLVE_SETTING_HANDLE(ComboboxHandle)
 
-	if (USettingCombobox* SettingCombobox = GetSettingSubWidget<USettingCombobox>(ComboboxTag))
+	SettingsEngineInternal.WriteRow(RowIndex, [InValue](FSettingsPicker& Row)
 	{
-		SettingCombobox->SetComboboxIndex(InValue);
-		OnAnySettingSet(SettingCombobox->GetSettingPrimaryRow());
-	}
+		return FSettingsEngine::SetComboboxIndex(Row, InValue);
+	});
 }
 
 // Set current value for a slider
 void USettingsWidget::SetSettingSlider(const FSettingTag& SliderTag, double InValue)
 {
-	static constexpr double MinValue = 0.0;
-	static constexpr float MaxValue = 1.0;
-	const double NewValue = FMath::Clamp(InValue, MinValue, MaxValue);
-	SET_SETTING_VALUE(SliderTag, Slider, ChosenValue, NewValue, OnSetterFloat);
+	SetSettingSliderByHandle(ResolveSettingHandle(SliderTag), InValue);
+}
 
-	if (USettingSlider* SettingSlider = GetSettingSubWidget<USettingSlider>(SliderTag))
+// Set current value for a slider by specified handle
+void USettingsWidget::SetSettingSliderByHandle(const FSettingHandle& SliderHandle, double InValue)
+{
+	RESOLVE_SETTING_HANDLE(SliderHandle)
+
+	SettingsEngineInternal.WriteRow(RowIndex, [InValue](FSettingsPicker& Row)
 	{
-		SettingSlider->SetSliderValue(NewValue);
-		OnAnySettingSet(SettingSlider->GetSettingPrimaryRow());
-	}
+		double NewValue = InValue;
+		return FSettingsEngine::SetSliderValue(Row, NewValue);
+	});
 }
 
 // Set new text
 void USettingsWidget::SetSettingTextLine(const FSettingTag& TextLineTag, const FText& InValue)
 {
-	if (!TextLineTag.IsValid())
+	SetSettingTextLineByHandle(ResolveSettingHandle(TextLineTag), InValue);
+}
+
+// Set new text by specified handle
+void USettingsWidget::SetSettingTextLineByHandle(const FSettingHandle& TextLineHandle, const FText& InValue)
+{
+	RESOLVE_SETTING_HANDLE(TextLineHandle)
+
+	SettingsEngineInternal.WriteRow(RowIndex, [&InValue](FSettingsPicker& Row)
 	{
-		return;
-	}
+		return FSettingsEngine::SetTextLineValue(Row, InValue);
+	});
+}
 
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(TextLineTag.GetTagName());
-	if (!SettingsRowPtr)
+// Set new text for an input box
+void USettingsWidget::SetSettingUserInput(const FSettingTag& UserInputTag, FName InValue)
+{
+	SetSettingUserInputByHandle(ResolveSettingHandle(UserInputTag), InValue);
+}
+
+// Set new text for an input box by specified handle
+void USettingsWidget::SetSettingUserInputByHandle(const FSettingHandle& UserInputHandle, FName InValue)
+{
+	RESOLVE_SETTING_HANDLE(UserInputHandle)
+
+	FName NewValue = InValue;
+	const ESettingWriteResult WriteResult = SettingsEngineInternal.WriteRow(RowIndex, [&NewValue](FSettingsPicker& Row)
 	{
-		return;
+		return FSettingsEngine::SetUserInputValue(Row, NewValue);
+	});
+
+	if (WriteResult == ESettingWriteResult::Redundant
+	    && NewValue != InValue)
+	{
+		// The string is limited to the already set one, so show the limited one instead of the typed one
+		RefreshSettingSubWidget(RowIndex);
 	}
 
-	FSettingsPrimary& PrimaryRef = SettingsRowPtr->PrimaryData;
-	FText& CaptionRef = PrimaryRef.Caption;
-	if (CaptionRef.EqualTo(InValue))
+	if (WriteResult == ESettingWriteResult::Changed
+	    && !IsSettingsBatchActive())
 	{
-		return;
+		PlayUIClickSFX();
 	}
+}
 
-	CaptionRef = InValue;
-	SettingsRowPtr->TextLine.OnSetterText.ExecuteIfBound(InValue);
-	UpdateSettingsByTags(PrimaryRef.SettingsToUpdate);
+// Set new custom widget for setting by specified tag
+void USettingsWidget::SetSettingCustomWidget(const FSettingTag& CustomWidgetTag, USettingCustomWidget* InCustomWidget)
+{
+	SetSettingCustomWidgetByHandle(ResolveSettingHandle(CustomWidgetTag), InCustomWidget);
+}
+
+// Set new custom widget for setting by specified handle
+void USettingsWidget::SetSettingCustomWidgetByHandle(const FSettingHandle& CustomWidgetHandle, USettingCustomWidget* InCustomWidget)
+{
+	RESOLVE_SETTING_HANDLE(CustomWidgetHandle)
 
-	if (USettingTextLine* SettingTextLine = Cast<USettingTextLine>(PrimaryRef.SettingSubWidget))
+	// Custom widgets exist only on UI, so they are set here, while the settings engine still reports the change and refreshes dependent settings
+	FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	SettingsEngineInternal.WriteRow(RowIndex, [&RowStore, RowIndex, InCustomWidget](FSettingsPicker& Row)
 	{
-		SettingTextLine->SetCaptionText(InValue);
-	}
+		TWeakObjectPtr<USettingSubWidget>& CustomWidgetRef = Row.PrimaryData.SettingSubWidget;
+		if (CustomWidgetRef == InCustomWidget)
+		{
+			return ESettingWriteResult::Redundant;
+		}
+
+		CustomWidgetRef = InCustomWidget;
+		RowStore.Widgets[RowIndex] = InCustomWidget;
+		INC_DWORD_STAT(STAT_SWC_SetterCalls);
+		SWC_SCOPE_SETTING_CALL(Row.PrimaryData.Tag, Setter);
+		Row.CustomWidget.OnSetterWidget.ExecuteIfBound(InCustomWidget);
+		return ESettingWriteResult::Changed;
+	});
 }
 
-// Set new text for an input box
-void USettingsWidget::SetSettingUserInput(const FSettingTag& UserInputTag, FName InValue)
+#undef RESOLVE_SETTING_HANDLE
+
+// Is called after any setting is changed
+void USettingsWidget::OnAnySettingSet_Implementation(const FSettingsPrimary& SettingPrimaryRow)
 {
-	if (!UserInputTag.IsValid())
+	if (SettingPrimaryRow.bApplyImmediately)
 	{
-		return;
+		ApplySettingsDeferred(SettingPrimaryRow.bApplyResolution);
 	}
+}
+
+// Set values of many settings at once in a string format, as SetSettingValue does for each of them
+void USettingsWidget::SetSettingsBatch(const TMap<FGameplayTag, FString>& SettingValues, bool bSaveSettings/* = false*/)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::SetSettingsBatch);
 
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(UserInputTag.GetTagName());
-	if (!SettingsRowPtr)
+	if (SettingValues.IsEmpty())
 	{
 		return;
 	}
 
-	FSettingsUserInput& UserInputRef = SettingsRowPtr->UserInput;
-	if (UserInputRef.UserInput.IsEqual(InValue)
-	    || InValue.IsNone())
+	// Dependent settings of all changed ones are updated once the outermost batch is finished
+	const FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	SettingsEngineInternal.BeginBatch();
+	for (const TTuple<FGameplayTag, FString>& It : SettingValues)
 	{
-		// Is not needed to update
-		return;
+		SettingsEngineInternal.WriteRowValue(RowStore.FindIndex(It.Key.GetTagName()), It.Value);
 	}
+	SettingsEngineInternal.EndBatch();
 
-	if (UserInputRef.MaxCharactersNumber > 0)
+	if (bSaveSettings)
 	{
-		// Limit the length of the string
-		const FString NewValueStr = InValue.ToString().Left(UserInputRef.MaxCharactersNumber);
-		InValue = *NewValueStr;
-
-		if (USettingUserInput* SettingUserInput = GetSettingSubWidget<USettingUserInput>(UserInputTag))
-		{
-			SettingUserInput->SetUserInputValue(InValue);
-			OnAnySettingSet(SettingUserInput->GetSettingPrimaryRow());
-		}
+		// Applies all changed settings as well
+		SaveSettings();
 	}
-
-	UserInputRef.UserInput = InValue;
-	UserInputRef.OnSetterName.ExecuteIfBound(InValue);
-	UpdateSettingsByTags(SettingsRowPtr->PrimaryData.SettingsToUpdate);
-
-	PlayUIClickSFX();
 }
 
-// Set new custom widget for setting by specified tag
-void USettingsWidget::SetSettingCustomWidget(const FSettingTag& CustomWidgetTag, USettingCustomWidget* InCustomWidget)
+// Sets all values of specified snapshot, e.g: to apply the graphics preset
+void USettingsWidget::ApplySettingsSnapshot(const FSettingsSnapshot& Snapshot, bool bSaveSettings/* = false*/)
 {
-	if (!CustomWidgetTag.IsValid())
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::ApplySettingsSnapshot);
+
+	if (Snapshot.IsEmpty())
 	{
 		return;
 	}
 
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(CustomWidgetTag.GetTagName());
-	if (!SettingsRowPtr)
+	FGameplayTagContainer SnapshotTags;
+	for (const FGameplayTag& TagIt : Snapshot.Tags)
 	{
-		return;
+		SnapshotTags.AddTagFast(TagIt);
 	}
 
-	TWeakObjectPtr<USettingSubWidget>& CustomWidgetRef = SettingsRowPtr->PrimaryData.SettingSubWidget;
-	if (CustomWidgetRef == InCustomWidget)
+	FSettingsSnapshot CurrentSnapshot;
+	CaptureSettingsSnapshot(SnapshotTags, /*Out*/ CurrentSnapshot);
+
+	FSettingsSnapshot ChangedSnapshot;
+	CurrentSnapshot.Diff(Snapshot, /*Out*/ ChangedSnapshot);
+	if (ChangedSnapshot.IsEmpty())
 	{
+		// Snapshot is already applied
 		return;
 	}
 
-	CustomWidgetRef.Reset();
-	CustomWidgetRef = InCustomWidget;
-	SettingsRowPtr->CustomWidget.OnSetterWidget.ExecuteIfBound(InCustomWidget);
-	UpdateSettingsByTags(SettingsRowPtr->PrimaryData.SettingsToUpdate);
+	TMap<FGameplayTag, FString> ChangedValues;
+	ChangedSnapshot.ToMap(/*Out*/ ChangedValues);
+	SetSettingsBatch(ChangedValues, bSaveSettings);
 
-	OnAnySettingSet(SettingsRowPtr->PrimaryData);
+	if (!bSaveSettings)
+	{
+		// Saving applies settings by itself, otherwise apply all changed settings at once
+		ApplySettings();
+	}
 }
 
-// Is called after any setting is changed
-void USettingsWidget::OnAnySettingSet_Implementation(const FSettingsPrimary& SettingPrimaryRow)
+// Returns how this widget and its columns cache their Slate content, is taken from the Settings Data Asset unless overridden
+ESettingsInvalidationMode USettingsWidget::GetInvalidationMode() const
 {
-	if (SettingPrimaryRow.bApplyImmediately)
+#if !UE_BUILD_SHIPPING
+	if (InvalidationModeOverrideInternal.IsSet())
 	{
-		ApplySettings();
+		return InvalidationModeOverrideInternal.GetValue();
 	}
+#endif // !UE_BUILD_SHIPPING
+
+	return USettingsDataAsset::Get().GetInvalidationMode();
 }
 
 /* ---------------------------------------------------
  *		Getters by setting types
  * --------------------------------------------------- */
 
-/** Retrieve a specific setting row using a given tag.
- * @param Tag The tag used to find the setting row.
- * @param DataMember The member that holds the desired value. */
-#define GET_SETTING_ROW(Tag, DataMember)                  \
-	const FSettingsPicker& FoundRow = GetSettingRow(Tag); \
-	if (!FoundRow.IsValid())                              \
-	{                                                     \
-		return;                                           \
-	}                                                     \
-	const auto& Data = FoundRow.DataMember;
-
-/** Executes the common pattern of getting a value from a data structure.
- * @param Tag The tag used to find the setting row.
- * @param DataMember The member that holds the desired value.
- * @param ValueType The type of value to retrieve.
- * @param ValueExpression The expression to retrieve the value.
- * @param GetterExpression The expression to retrieve the getter delegate.
- * @param DefaultValue The default value to return if no value is found. */
-#define GET_SETTING_VALUE(Tag, DataMember, ValueType, ValueExpression, GetterExpression, DefaultValue) \
-	{                                                                                                  \
-		const FSettingsPicker& FoundRow = GetSettingRow(Tag);                                          \
-		ValueType Value = DefaultValue;                                                                \
-		if (FoundRow.IsValid())                                                                        \
-		{                                                                                              \
-			const auto& Data = FoundRow.DataMember;                                                    \
-			Value = ValueExpression;                                                                   \
-			const auto& Getter = GetterExpression;                                                     \
-			if (Getter.IsBound())                                                                      \
-			{                                                                                          \
-				Value = Getter.Execute();                                                              \
-			}                                                                                          \
-		}                                                                                              \
-		return Value;                                                                                  \
-	}
-
 // Returns is a checkbox toggled
 bool USettingsWidget::GetCheckboxValue(const FSettingTag& CheckboxTag) const
 {
-	GET_SETTING_VALUE(CheckboxTag, Checkbox, bool, Data.bIsSet, Data.OnGetterBool, false);
+	return GetCheckboxValueByHandle(ResolveSettingHandle(CheckboxTag));
+}
+
+// Returns is a checkbox toggled by specified handle
+bool USettingsWidget::GetCheckboxValueByHandle(const FSettingHandle& CheckboxHandle) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRowByHandle(CheckboxHandle);
+	return FoundRow.IsValid() ? FSettingsEngine::GetCheckboxValue(FoundRow) : false;
 }
 
 // Returns chosen member index of a combobox
 int32 USettingsWidget::GetComboboxIndex(const FSettingTag& ComboboxTag) const
 {
-	GET_SETTING_VALUE(ComboboxTag, Combobox, int32, Data.ChosenMemberIndex, Data.OnGetterInt, 0);
+	return GetComboboxIndexByHandle(ResolveSettingHandle(ComboboxTag));
+}
+
+// Returns chosen member index of a combobox by specified handle
+int32 USettingsWidget::GetComboboxIndexByHandle(const FSettingHandle& ComboboxHandle) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRowByHandle(ComboboxHandle);
+	return FoundRow.IsValid() ? FSettingsEngine::GetComboboxIndex(FoundRow) : 0;
 }
 
 // Get all members of a combobox
 void USettingsWidget::GetComboboxMembers(const FSettingTag& ComboboxTag, TArray<FText>& OutMembers) const
 {
-	GET_SETTING_ROW(ComboboxTag, Combobox)
-	OutMembers = Data.Members;
-	Data.OnGetMembers.ExecuteIfBound(OutMembers);
+	GetComboboxMembersByHandle(ResolveSettingHandle(ComboboxTag), OutMembers);
+}
+
+// Get all members of a combobox by specified handle
+void USettingsWidget::GetComboboxMembersByHandle(const FSettingHandle& ComboboxHandle, TArray<FText>& OutMembers) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRowByHandle(ComboboxHandle);
+	if (FoundRow.IsValid())
+	{
+		FSettingsEngine::GetComboboxMembers(FoundRow, OutMembers);
+	}
 }
 
 // Get current value of a slider [0...1]
 double USettingsWidget::GetSliderValue(const FSettingTag& SliderTag) const
 {
-	GET_SETTING_VALUE(SliderTag, Slider, double, Data.ChosenValue, Data.OnGetterFloat, 0.f);
+	return GetSliderValueByHandle(ResolveSettingHandle(SliderTag));
+}
+
+// Get current value of a slider [0...1] by specified handle
+double USettingsWidget::GetSliderValueByHandle(const FSettingHandle& SliderHandle) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRowByHandle(SliderHandle);
+	return FoundRow.IsValid() ? FSettingsEngine::GetSliderValue(FoundRow) : 0.0;
 }
 
 // Get current text of a simple text widget
 void USettingsWidget::GetTextLineValue(const FSettingTag& TextLineTag, FText& OutText) const
 {
-	GET_SETTING_ROW(TextLineTag, PrimaryData)
-	OutText = Data.Caption;
-	FoundRow.TextLine.OnGetterText.ExecuteIfBound(OutText);
+	GetTextLineValueByHandle(ResolveSettingHandle(TextLineTag), OutText);
+}
+
+// Get current text of a simple text widget by specified handle
+void USettingsWidget::GetTextLineValueByHandle(const FSettingHandle& TextLineHandle, FText& OutText) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRowByHandle(TextLineHandle);
+	if (FoundRow.IsValid())
+	{
+		FSettingsEngine::GetTextLineValue(FoundRow, OutText);
+	}
 }
 
 // Get current input name of the text input
 FName USettingsWidget::GetUserInputValue(const FSettingTag& UserInputTag) const
 {
-	GET_SETTING_VALUE(UserInputTag, UserInput, FName, Data.UserInput, Data.OnGetterName, NAME_None);
+	return GetUserInputValueByHandle(ResolveSettingHandle(UserInputTag));
+}
+
+// Get current input name of the text input by specified handle
+FName USettingsWidget::GetUserInputValueByHandle(const FSettingHandle& UserInputHandle) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRowByHandle(UserInputHandle);
+	return FoundRow.IsValid() ? FSettingsEngine::GetUserInputValue(FoundRow) : NAME_None;
 }
 
 // Get custom widget of the setting by specified tag
 USettingCustomWidget* USettingsWidget::GetCustomWidget(const FSettingTag& CustomWidgetTag) const
 {
-	GET_SETTING_VALUE(CustomWidgetTag, CustomWidget, USettingCustomWidget*, Cast<USettingCustomWidget>(FoundRow.PrimaryData.SettingSubWidget.Get()), Data.OnGetterWidget, nullptr);
+	return GetCustomWidgetByHandle(ResolveSettingHandle(CustomWidgetTag));
+}
+
+// Get custom widget of the setting by specified handle
+USettingCustomWidget* USettingsWidget::GetCustomWidgetByHandle(const FSettingHandle& CustomWidgetHandle) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRowByHandle(CustomWidgetHandle);
+	if (!FoundRow.IsValid())
+	{
+		return nullptr;
+	}
+
+	// Custom widgets exist only on UI, so they are taken here instead of the settings engine
+	const auto& Getter = FoundRow.CustomWidget.OnGetterWidget;
+	if (Getter.IsBound())
+	{
+		INC_DWORD_STAT(STAT_SWC_GetterCalls);
+		SWC_SCOPE_SETTING_CALL(FoundRow.PrimaryData.Tag, Getter);
+		return Getter.Execute();
+	}
+
+	return Cast<USettingCustomWidget>(FoundRow.PrimaryData.SettingSubWidget.Get());
 }
 
 // Get setting widget object by specified tag
 USettingSubWidget* USettingsWidget::GetSettingSubWidget(const FSettingTag& SettingTag) const
 {
-	const FSettingsPrimary& PrimaryData = GetSettingRow(SettingTag).PrimaryData;
+	return GetSettingSubWidgetByHandle(ResolveSettingHandle(SettingTag));
+}
+
+// Get setting widget object by specified handle
+USettingSubWidget* USettingsWidget::GetSettingSubWidgetByHandle(const FSettingHandle& SettingHandle) const
+{
+	const FSettingsPrimary& PrimaryData = GetSettingRowByHandle(SettingHandle).PrimaryData;
 	return PrimaryData.IsValid() ? PrimaryData.SettingSubWidget.Get() : nullptr;
 }
 
+// Captures current values of settings, so they can be diffed, applied later or stored in the user save
+void USettingsWidget::CaptureSettingsSnapshot(const FGameplayTagContainer& SettingTags, FSettingsSnapshot& OutSnapshot) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::CaptureSettingsSnapshot);
+
+	const FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+
+	OutSnapshot = FSettingsSnapshot::EmptySnapshot;
+
+	TArray<int32> RowIndices;
+	if (SettingTags.IsEmpty())
+	{
+		RowIndices.Reserve(RowStore.Num());
+		for (int32 RowIndex = 0; RowIndex < RowStore.Num(); ++RowIndex)
+		{
+			RowIndices.Emplace(RowIndex);
+		}
+	}
+	else
+	{
+		RowStore.FindIndicesByTags(SettingTags, /*Out*/ RowIndices);
+	}
+
+	OutSnapshot.Tags.Reserve(RowIndices.Num());
+	OutSnapshot.Values.Reserve(RowIndices.Num());
+	for (const int32 RowIndex : RowIndices)
+	{
+		// Buttons and other settings without value are not captured
+		const FSettingsDataBase* ChosenData = RowStore.GetRow(RowIndex).GetChosenSettingsData();
+		if (!ChosenData
+		    || !RowStore.HasFlag(RowIndex, ESettingRowFlags::CanUpdate))
+		{
+			continue;
+		}
+
+		FString Value;
+		const FSettingTag& SettingTag = RowStore.GetTag(RowIndex);
+		ChosenData->GetSettingValue(*this, SettingTag, /*Out*/ Value);
+		OutSnapshot.Add(SettingTag, Value);
+	}
+}
+
+// Get values of many settings at once in a string format
+void USettingsWidget::GetSettingsBatch(const FGameplayTagContainer& SettingTags, TMap<FGameplayTag, FString>& OutSettingValues) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::GetSettingsBatch);
+
+	const FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+
+	OutSettingValues.Reset();
+
+	TArray<int32> RowIndices;
+	RowStore.FindIndicesByTags(SettingTags, /*Out*/ RowIndices);
+	OutSettingValues.Reserve(RowIndices.Num());
+
+	for (const int32 RowIndex : RowIndices)
+	{
+		const FSettingsDataBase* ChosenData = RowStore.GetRow(RowIndex).GetChosenSettingsData();
+		if (!ChosenData)
+		{
+			continue;
+		}
+
+		const FSettingTag& SettingTag = RowStore.GetTag(RowIndex);
+		FString& ValueRef = OutSettingValues.Emplace(SettingTag);
+		ChosenData->GetSettingValue(*this, SettingTag, /*Out*/ ValueRef);
+	}
+}
+
 /* ---------------------------------------------------
  *		Style
  * --------------------------------------------------- */
@@ -545,7 +784,7 @@ FVector2D USettingsWidget::GetSubWidgetsSize(int32 SectionsBitmask) const
 		if (DesiredWidgetIt)
 		{
 			const FVector2D SubWidgetHeight = DesiredWidgetIt->GetDesiredSize();
-			ensureAlwaysMsgf(!SubWidgetHeight.IsZero(), TEXT("ASSERT: 'SubWidgetHeight' is zero, can't get the size of subwidget, most likely widget is not initialized yet, call ForceLayoutPrepass()"));
+			ensureAlwaysMsgf(!SubWidgetHeight.IsZero(), TEXT("ASSERT: 'SubWidgetHeight' is zero, can't get the size of subwidget, most likely it's not measured yet, so its size has to be requested after the layout pass, see UpdateScrollBoxesHeight()"));
 			SubWidgetsHeight += SubWidgetHeight;
 		}
 	}
@@ -583,34 +822,25 @@ float USettingsWidget::GetScrollBoxHeight() const
 // Is blueprint-event called that returns the style brush by specified button state
 FSlateBrush USettingsWidget::GetButtonBrush(ESettingsButtonState State)
 {
-	const USettingsDataAsset& SettingsDataAsset = USettingsDataAsset::Get();
-	const FMiscThemeData& MiscThemeData = SettingsDataAsset.GetMiscThemeData();
-	const FButtonThemeData& ButtonThemeData = SettingsDataAsset.GetButtonThemeData();
+	return FSettingsStyleSet::Get().GetButtonBrush(State);
+}
 
-	FSlateColor SlateColor;
-	switch (State)
-	{
-		case ESettingsButtonState::Normal:
-			SlateColor = MiscThemeData.ThemeColorNormal;
-			break;
-		case ESettingsButtonState::Hovered:
-			SlateColor = MiscThemeData.ThemeColorHover;
-			break;
-		case ESettingsButtonState::Pressed:
-			SlateColor = MiscThemeData.ThemeColorExtra;
-			break;
-		default:
-			SlateColor = FLinearColor::White;
-	}
+// Returns the cached style brush by specified checkbox state
+FSlateBrush USettingsWidget::GetCheckboxBrush(ESettingsCheckboxState State)
+{
+	return FSettingsStyleSet::Get().GetCheckboxBrush(State);
+}
 
-	FSlateBrush SlateBrush;
-	SlateBrush.TintColor = SlateColor;
-	SlateBrush.DrawAs = ButtonThemeData.DrawAs;
-	SlateBrush.Margin = ButtonThemeData.Margin;
-	SlateBrush.SetImageSize(ButtonThemeData.Size);
-	SlateBrush.SetResourceObject(ButtonThemeData.Texture);
+// Returns the cached style brush by specified slider state
+FSlateBrush USettingsWidget::GetSliderBrush(ESettingsSliderState State)
+{
+	return FSettingsStyleSet::Get().GetSliderBrush(State);
+}
 
-	return SlateBrush;
+// Returns the cached style brush of the combobox by specified state
+FSlateBrush USettingsWidget::GetComboboxBrush(ESettingsButtonState State)
+{
+	return FSettingsStyleSet::Get().GetComboboxBrush(State);
 }
 
 /* ---------------------------------------------------
@@ -622,6 +852,11 @@ void USettingsWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
+	if (USettingsWidgetSubsystem* SettingsWidgetSubsystem = USettingsWidgetSubsystem::Get(this))
+	{
+		SettingsWidgetSubsystem->RegisterSettingsWidget(this);
+	}
+
 	if (USettingsDataAsset::Get().IsAutoConstruct())
 	{
 		TryConstructSettings();
@@ -635,9 +870,53 @@ void USettingsWidget::NativeDestruct()
 {
 	Super::NativeDestruct();
 
+	if (USettingsWidgetSubsystem* SettingsWidgetSubsystem = USettingsWidgetSubsystem::Get(this))
+	{
+		SettingsWidgetSubsystem->UnregisterSettingsWidget(this);
+	}
+
+	// Don't lose changes that were requested to be applied at the end of this frame
+	if (bPendingApplySettingsInternal)
+	{
+		OnEndFrameApplySettings();
+	}
+
 	RemoveAllSettings();
 }
 
+// Is overridden to wrap the whole settings into the invalidation root according to the invalidation mode
+TSharedRef<SWidget> USettingsWidget::RebuildWidget()
+{
+	return USettingsUtilsLibrary::WrapInvalidationRoot(Super::RebuildWidget(), GetInvalidationMode(), GetFName());
+}
+
+#if !UE_BUILD_SHIPPING
+// Paints the latency profiler overlay over settings if it's enabled
+int32 USettingsWidget::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	int32 MaxLayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+	const int32 OverlayRowsNum = FSettingsLatencyProfiler::GetOverlayRowsNum();
+	if (OverlayRowsNum > 0)
+	{
+		TArray<FSettingCallStats> TopStats;
+		FSettingsLatencyProfiler::GetTopOffenders(OverlayRowsNum, TopStats);
+
+		FString OverlayString = TEXT("Settings latency (total / avg / max ms, calls):");
+		for (const FSettingCallStats& StatsIt : TopStats)
+		{
+			OverlayString += FString::Printf(TEXT("\n%s %s: %.3f / %.3f / %.3f, %d"), *StatsIt.Tag.ToString(), FSettingsLatencyProfiler::GetCallKindName(StatsIt.Kind), StatsIt.TotalMs, StatsIt.GetAvgMs(), StatsIt.MaxMs, StatsIt.CallsNum);
+		}
+
+		static const FSlateFontInfo OverlayFont = FCoreStyle::GetDefaultFontStyle(TEXT("Mono"), 10);
+		static const FVector2f OverlayOffset(16.f, 16.f);
+		FSlateDrawElement::MakeText(OutDrawElements, ++MaxLayerId, AllottedGeometry.ToOffsetPaintGeometry(OverlayOffset), OverlayString, OverlayFont, ESlateDrawEffect::None, FLinearColor::Yellow);
+	}
+
+	return MaxLayerId;
+}
+#endif // !UE_BUILD_SHIPPING
+
 // Is called right after the game was started and windows size is set to construct settings
 void USettingsWidget::OnViewportResizedWhenInit(FViewport* Viewport, uint32 Index)
 {
@@ -652,6 +931,9 @@ void USettingsWidget::OnViewportResizedWhenInit(FViewport* Viewport, uint32 Inde
 // Construct all settings from the settings data table
 void USettingsWidget::ConstructSettings()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::ConstructSettings);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_ConstructSettings);
+
 	if (IsSettingsWidgetConstructed())
 	{
 		// Settings are already constructed
@@ -663,46 +945,76 @@ void USettingsWidget::ConstructSettings()
 	// BP implementation to cache some data before creating subwidgets
 	OnConstructSettings();
 
-	FGameplayTagContainer AddedSettings;
-	for (TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	// Functions of all owner classes are collected in parallel, so rows below are bound without walking classes
+	FSettingsEngine::PrefetchOwnerFunctions(SettingsEngineInternal.GetRowStore(), this);
+
+	for (TTuple<FName, FSettingsPicker>& RowIt : SettingsEngineInternal.GetRows())
 	{
 		FSettingsPicker& SettingRef = RowIt.Value;
 		BindSetting(SettingRef);
 		AddSetting(SettingRef);
-		AddedSettings.AddTag(SettingRef.PrimaryData.Tag);
 	}
 
-	UpdateSettingsByTags(AddedSettings, /*bLoadFromConfig*/ true);
+	UpdateAllSettings(/*bLoadFromConfig*/ true);
 
 	UpdateScrollBoxesHeight();
 
 	ApplySettings();
+
+	FSettingsTextCache* TextCache = FSettingsTextCache::Get();
+	if (TextCache
+	    && !CultureChangedHandleInternal.IsValid())
+	{
+		CultureChangedHandleInternal = TextCache->OnCultureChanged().AddUObject(this, &ThisClass::OnCultureChanged);
+	}
 }
 
 // Internal function to cache setting rows from Settings Data Table
 void USettingsWidget::CacheTable()
 {
-	TMap<FName, FSettingsPicker> SettingRows;
-	USettingsUtilsLibrary::GenerateAllSettingRows(/*Out*/ SettingRows);
-	if (!ensureMsgf(!SettingRows.IsEmpty(), TEXT("ASSERT: 'SettingRows' are empty")))
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::CacheTable);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_CacheTable);
+
+	TSet<const USettingsDataTable*> DataTables;
+#if !UE_BUILD_SHIPPING
+	for (const TWeakObjectPtr<const USettingsDataTable>& DataTableIt : DataTablesOverrideInternal)
+	{
+		if (const USettingsDataTable* DataTable = DataTableIt.Get())
+		{
+			DataTables.Add(DataTable);
+		}
+	}
+#endif // !UE_BUILD_SHIPPING
+
+	if (DataTables.IsEmpty())
+	{
+		USettingsUtilsLibrary::GetAllSettingDataTables(/*Out*/ DataTables);
+	}
+
+	// Rows are merged and indexed once for all local players, e.g: in split-screen, while each player copies only rows to bind them
+	USettingsCatalogSubsystem* CatalogSubsystem = USettingsCatalogSubsystem::Get(this);
+	const TSharedRef<const FSettingsSharedCatalog> SharedCatalog = CatalogSubsystem ? CatalogSubsystem->GetSharedCatalog(DataTables) : FSettingsSharedCatalog::Build(DataTables);
+	if (!ensureMsgf(SharedCatalog->Num() > 0, TEXT("ASSERT: 'SettingRows' are empty")))
 	{
 		return;
 	}
 
-	// Reset values if currently are set
-	SettingsTableRowsInternal.Empty();
-	SettingsTableRowsInternal.Reserve(SettingRows.Num());
-	for (const TTuple<FName, FSettingsPicker>& SettingRowIt : SettingRows)
+	// Reset values if currently are set, rows are bound later together with their sub-widgets
+	SettingsEngineInternal.InitializeRows(this, SharedCatalog);
+
+	if (!SettingsEngineInternal.OnSettingChanged().IsBoundToObject(this))
 	{
-		const FSettingsPicker& SettingsPicker = SettingRowIt.Value;
-		SettingsTableRowsInternal.Emplace(SettingRowIt.Key, SettingsPicker);
+		SettingsEngineInternal.OnSettingChanged().AddUObject(this, &ThisClass::OnEngineSettingChanged);
 	}
+
+	// Previous row indices are not valid anymore
+	DirtyRowIndicesInternal.Reset();
 }
 
 // Clears all added settings
 void USettingsWidget::RemoveAllSettings()
 {
-	for (TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	for (TTuple<FName, FSettingsPicker>& RowIt : SettingsEngineInternal.GetRows())
 	{
 		USettingSubWidget* SubWidget = RowIt.Value.PrimaryData.SettingSubWidget.Get();
 		if (ensureMsgf(SubWidget, TEXT("ASSERT: [%i] %s:\n'SubWidget' is not valid!"), __LINE__, *FString(__FUNCTION__)))
@@ -710,7 +1022,25 @@ void USettingsWidget::RemoveAllSettings()
 			FSWCWidgetUtilsLibrary::DestroyWidget(*SubWidget);
 		}
 	}
-	SettingsTableRowsInternal.Empty();
+	SettingsEngineInternal.Reset();
+
+	if (CultureChangedHandleInternal.IsValid())
+	{
+		// The cache is already released if the module is shut down before this widget, so there is nothing to unbind
+		if (FSettingsTextCache* TextCache = FSettingsTextCache::Get())
+		{
+			TextCache->OnCultureChanged().Remove(CultureChangedHandleInternal);
+		}
+		CultureChangedHandleInternal.Reset();
+	}
+	DirtyRowIndicesInternal.Reset();
+
+	if (SharedTooltipInternal)
+	{
+		// Next hover has to refill the tooltip even for the same tag, since its row is removed
+		SharedTooltipInternal->SetSettingPrimaryRow(FSettingsPrimary::EmptyPrimary);
+		SharedTooltipInternal->SetToolTipText(FText::GetEmpty());
+	}
 
 	for (USettingColumn* ColumnIt : ColumnsInternal)
 	{
@@ -720,63 +1050,149 @@ void USettingsWidget::RemoveAllSettings()
 		}
 	}
 	ColumnsInternal.Empty();
+
+	// Columns are removed, so there is nothing to size
+	CancelScrollBoxesHeight();
 }
 
-// Is called when In-Game menu became opened or closed
-void USettingsWidget::OnToggleSettings(bool bIsVisible)
+// Updates texts of all constructed settings in place after the culture is changed instead of rebuilding the whole menu
+void USettingsWidget::OnCultureChanged()
 {
-	PlayUIClickSFX();
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::OnCultureChanged);
 
-	if (OnToggledSettings.IsBound())
+	FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+
+	TArray<int32> TextLineIndices;
+	for (int32 RowIndex = 0; RowIndex < RowStore.Num(); ++RowIndex)
 	{
-		OnToggledSettings.Broadcast(bIsVisible);
+		const ESettingArchetype Archetype = RowStore.GetArchetype(RowIndex);
+		if (Archetype == ESettingArchetype::Combobox)
+		{
+			// Owner might build members for the current culture
+			FSettingsCombobox& ComboboxData = RowStore.GetRow(RowIndex).Combobox;
+			ComboboxData.OnGetMembers.ExecuteIfBound(ComboboxData.Members);
+		}
+		else if (Archetype == ESettingArchetype::TextLine)
+		{
+			TextLineIndices.Emplace(RowIndex);
+		}
+
+		if (USettingSubWidget* SubWidget = RowStore.Widgets[RowIndex].Get())
+		{
+			SubWidget->RefreshTexts();
+		}
+	}
+
+	// Text lines might be also built by their getters for the current culture
+	SettingsEngineInternal.RefreshSettings(TextLineIndices);
+
+	// Shared tooltip still shows the text of the last hovered setting
+	if (SharedTooltipInternal && SharedTooltipInternal->GetSettingTag().IsValid())
+	{
+		SharedTooltipInternal->SetToolTipText(GetSettingRow(SharedTooltipInternal->GetSettingTag()).PrimaryData.Tooltip);
 	}
 }
 
-// Bind and set static object delegate
-bool USettingsWidget::TryBindOwner(FSettingsPrimary& Primary)
+// Is called by the settings engine after the value of any setting is changed to show it on UI
+void USettingsWidget::OnEngineSettingChanged(const FSettingTag& SettingTag)
 {
-	const UObject* FoundContextObj = nullptr;
-	const FSettingFunctionPicker& Owner = Primary.Owner;
-	if (Owner.IsValid())
+	const FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	const int32 RowIndex = RowStore.FindIndex(SettingTag.GetTagName());
+	if (!RowStore.IsValidIndex(RowIndex))
 	{
-		Primary.OwnerFunc.BindUFunction(Owner.FunctionClass->GetDefaultObject(), Owner.FunctionName);
-		FoundContextObj = Primary.GetSettingOwner(this);
+		return;
 	}
 
-	if (!FoundContextObj)
-	{
-		if (Owner.IsValid())
-		{
-			// Static context function is set, but returning object is null,
-			// most likely such object is not initialized yet,
-			// defer binding to try to rebind it later
-			DeferredBindingsInternal.AddTag(Primary.Tag);
-		}
+	RefreshSettingSubWidget(RowIndex);
 
-		return false;
+	OnAnySettingSet(RowStore.GetRow(RowIndex).PrimaryData);
+}
+
+// Shows the current value of the row by specified index on its sub-widget
+void USettingsWidget::RefreshSettingSubWidget(int32 RowIndex)
+{
+	const FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	USettingSubWidget* SubWidget = RowStore.Widgets[RowIndex].Get();
+	if (!SubWidget)
+	{
+		return;
 	}
 
-	const UClass* ContextClass = FoundContextObj->GetClass();
-	checkf(ContextClass, TEXT("ERROR: [%i] %s:\n'ContextClass' is null!"), __LINE__, *FString(__FUNCTION__));
+	if (USettingSlateRow* SlateRow = Cast<USettingSlateRow>(SubWidget))
+	{
+		// Native row reads the value from the row by itself
+		SlateRow->RefreshValue();
+		return;
+	}
 
-	// Cache all functions that are contained in returned object
-	for (TFieldIterator<UFunction> It(ContextClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	const FSettingsPicker& Row = RowStore.GetRow(RowIndex);
+	switch (RowStore.GetArchetype(RowIndex))
 	{
-		const UFunction* FunctionIt = *It;
-		if (!FunctionIt)
+	case ESettingArchetype::Checkbox:
+		if (USettingCheckbox* SettingCheckbox = Cast<USettingCheckbox>(SubWidget))
 		{
-			continue;
+			SettingCheckbox->SetCheckboxValue(Row.Checkbox.bIsSet);
 		}
-
-		const FName FunctionNameIt = FunctionIt->GetFName();
-		if (!FunctionNameIt.IsNone())
+		break;
+	case ESettingArchetype::Combobox:
+		if (USettingCombobox* SettingCombobox = Cast<USettingCombobox>(SubWidget))
+		{
+			SettingCombobox->SetComboboxIndex(Row.Combobox.ChosenMemberIndex);
+		}
+		break;
+	case ESettingArchetype::Slider:
+		if (USettingSlider* SettingSlider = Cast<USettingSlider>(SubWidget))
+		{
+			SettingSlider->SetSliderValue(Row.Slider.ChosenValue);
+		}
+		break;
+	case ESettingArchetype::TextLine:
+		if (USettingTextLine* SettingTextLine = Cast<USettingTextLine>(SubWidget))
 		{
-			Primary.OwnerFunctionList.Emplace(FunctionNameIt);
+			SettingTextLine->SetCaptionText(Row.PrimaryData.Caption);
 		}
+		break;
+	case ESettingArchetype::UserInput:
+		if (USettingUserInput* SettingUserInput = Cast<USettingUserInput>(SubWidget))
+		{
+			SettingUserInput->SetUserInputValue(Row.UserInput.UserInput);
+		}
+		break;
+	default:
+		// Buttons have no value to show, custom widgets show their values by themselves
+		break;
 	}
+}
 
-	return true;
+// Is called when In-Game menu became opened or closed
+void USettingsWidget::OnToggleSettings(bool bIsVisible)
+{
+	PlayUIClickSFX();
+
+	if (OnToggledSettings.IsBound())
+	{
+		OnToggledSettings.Broadcast(bIsVisible);
+	}
+}
+
+// Bind and set static object delegate
+bool USettingsWidget::TryBindOwner(FSettingsPrimary& Primary)
+{
+	// Is shared with the headless Settings Engine, so both bind owners the same way
+	if (FSettingsEngine::BindOwner(Primary, this))
+	{
+		return true;
+	}
+
+	if (Primary.Owner.IsValid())
+	{
+		// Static context function is set, but returning object is null,
+		// most likely such object is not initialized yet,
+		// defer binding to try to rebind it later
+		DeferredBindingsInternal.AddTag(Primary.Tag);
+	}
+
+	return false;
 }
 
 // Creates new widget based on specified setting class and sets it to specified primary data
@@ -788,7 +1204,14 @@ USettingSubWidget* USettingsWidget::CreateSettingSubWidget(FSettingsPrimary& InO
 	}
 
 	USettingSubWidget* SettingSubWidget = CreateWidget<USettingSubWidget>(this, SettingSubWidgetClass);
+	INC_DWORD_STAT(STAT_SWC_WidgetsCreated);
 	InOutPrimary.SettingSubWidget = SettingSubWidget;
+	FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	const int32 RowIndex = RowStore.FindIndex(InOutPrimary.Tag.GetTagName());
+	if (RowStore.IsValidIndex(RowIndex))
+	{
+		RowStore.Widgets[RowIndex] = SettingSubWidget;
+	}
 	SettingSubWidget->SetSettingsWidget(this);
 	SettingSubWidget->SetSettingPrimaryRow(InOutPrimary);
 	SettingSubWidget->SetLineHeight(InOutPrimary.LineHeight);
@@ -800,7 +1223,40 @@ USettingSubWidget* USettingsWidget::CreateSettingSubWidget(FSettingsPrimary& InO
 // Automatically sets the height for all scrollboxes in the Settings
 void USettingsWidget::UpdateScrollBoxesHeight()
 {
-	ForceLayoutPrepass(); // Call it to make GetSettingsHeight work since it is called during widget construction
+	if (!FSlateApplication::IsInitialized())
+	{
+		// Nothing is painted, so there is no reason to wait
+		ApplyScrollBoxesHeight();
+		return;
+	}
+
+	// Settings might be still added in this frame, so wait once for the next Slate tick that happens right before the paint
+	if (!ScrollBoxesHeightHandleInternal.IsValid())
+	{
+		ScrollBoxesHeightHandleInternal = FSlateApplication::Get().OnPreTick().AddUObject(this, &ThisClass::OnPreTickScrollBoxesHeight);
+	}
+}
+
+// Sets the height for all scrollboxes right away, only header and footer are measured instead of the whole tree
+bool USettingsWidget::ApplyScrollBoxesHeight()
+{
+	for (UWidget* SectionIt : TArray<UWidget*, TInlineAllocator<2>>{HeaderVerticalBox, FooterVerticalBox})
+	{
+		if (!SectionIt)
+		{
+			continue;
+		}
+
+		if (!SectionIt->GetCachedWidget())
+		{
+			// Is not added to the viewport yet
+			return false;
+		}
+
+		// Is cheap in comparison with the prepass of the whole tree, since there are no settings columns
+		SectionIt->ForceLayoutPrepass();
+	}
+
 	const float ScrollBoxHeight = GetScrollBoxHeight();
 
 	for (const USettingColumn* ColumnIt : ColumnsInternal)
@@ -811,6 +1267,28 @@ void USettingsWidget::UpdateScrollBoxesHeight()
 			SizeBoxWidget->SetMaxDesiredHeight(ScrollBoxHeight);
 		}
 	}
+
+	return true;
+}
+
+// Is called once on the start of the Slate tick after the scrollboxes height was requested, before anything is painted
+void USettingsWidget::OnPreTickScrollBoxesHeight(float DeltaTime)
+{
+	if (ApplyScrollBoxesHeight())
+	{
+		CancelScrollBoxesHeight();
+	}
+}
+
+// Stops waiting for the next Slate tick to set the scrollboxes height
+void USettingsWidget::CancelScrollBoxesHeight()
+{
+	if (ScrollBoxesHeightHandleInternal.IsValid()
+	    && FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().OnPreTick().Remove(ScrollBoxesHeightHandleInternal);
+	}
+	ScrollBoxesHeightHandleInternal.Reset();
 }
 
 // Constructs settings if viewport is ready otherwise Wait until viewport become initialized
@@ -863,7 +1341,7 @@ void USettingsWidget::OpenSettings()
 
 	TryRebindDeferredContexts();
 
-	UpdateAllSettings();
+	RefreshSettingsOnOpen();
 
 	SetVisibility(ESlateVisibility::Visible);
 
@@ -934,6 +1412,9 @@ void USettingsWidget::TryFocusOnUI()
 // Bind setting to specified Get/Set delegates, so both methods will be called
 bool USettingsWidget::BindSetting(FSettingsPicker& Setting)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::BindSetting);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_BindSetting);
+
 	FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
 	if (!ChosenData)
 	{
@@ -950,29 +1431,19 @@ bool USettingsWidget::BindSetting(FSettingsPicker& Setting)
 }
 
 /**
- * Macro to create and bind a UI widget.
+ * Binds getter and setter delegates of the setting data to its owner, the binding itself is shared with the settings engine.
  * @param Primary				Primary settings for the widget
  * @param Data					Data structure containing widget properties
  * @param GetterFunction		The getter function to bind
  * @param SetterFunction		The setter function to bind
- * @param AdditionalFunctionCalls Any additional function calls needed for specific widgets
  */
-#define BIND_SETTING(Primary, Data, GetterFunction, SetterFunction)                 \
-	do                                                                              \
-	{                                                                               \
-		if (UObject* OwnerObject = Primary.GetSettingOwner(this))                   \
-		{                                                                           \
-			const FName GetterFunctionName = Primary.Getter.FunctionName;           \
-			if (Primary.OwnerFunctionList.Contains(GetterFunctionName))             \
-			{                                                                       \
-				Data.GetterFunction.BindUFunction(OwnerObject, GetterFunctionName); \
-			}                                                                       \
-			const FName SetterFunctionName = Primary.Setter.FunctionName;           \
-			if (Primary.OwnerFunctionList.Contains(SetterFunctionName))             \
-			{                                                                       \
-				Data.SetterFunction.BindUFunction(OwnerObject, SetterFunctionName); \
-			}                                                                       \
-		}                                                                           \
+#define BIND_SETTING(Primary, Data, GetterFunction, SetterFunction)                                         \
+	do                                                                                                      \
+	{                                                                                                       \
+		if (UObject* OwnerObject = Primary.GetSettingOwner(this))                                           \
+		{                                                                                                   \
+			FSettingsEngine::BindFunctions(Primary, OwnerObject, Data.GetterFunction, Data.SetterFunction); \
+		}                                                                                                   \
 	} while (0)
 
 // Bind button to own Get/Set delegates
@@ -994,19 +1465,7 @@ void USettingsWidget::BindCombobox(const FSettingsPrimary& Primary, FSettingsCom
 
 	if (UObject* OwnerObject = Primary.GetSettingOwner(this))
 	{
-		const FName GetMembersFunctionName = Data.GetMembers.FunctionName;
-		if (Primary.OwnerFunctionList.Contains(GetMembersFunctionName))
-		{
-			Data.OnGetMembers.BindUFunction(OwnerObject, GetMembersFunctionName);
-			Data.OnGetMembers.ExecuteIfBound(Data.Members);
-		}
-
-		const FName SetMembersFunctionName = Data.SetMembers.FunctionName;
-		if (Primary.OwnerFunctionList.Contains(SetMembersFunctionName))
-		{
-			Data.OnSetMembers.BindUFunction(OwnerObject, SetMembersFunctionName);
-			Data.OnSetMembers.ExecuteIfBound(Data.Members);
-		}
+		FSettingsEngine::BindComboboxMembers(Primary, OwnerObject, Data);
 	}
 }
 
@@ -1046,7 +1505,7 @@ void USettingsWidget::TryRebindDeferredContexts()
 	FGameplayTagContainer ReboundSettings;
 	for (const FGameplayTag& TagIt : DeferredBindingsInternal)
 	{
-		FSettingsPicker* FoundRowPtr = TagIt.IsValid() ? SettingsTableRowsInternal.Find(TagIt.GetTagName()) : nullptr;
+		FSettingsPicker* FoundRowPtr = TagIt.IsValid() ? SettingsEngineInternal.GetRows().Find(TagIt.GetTagName()) : nullptr;
 		if (FoundRowPtr
 		    && BindSetting(*FoundRowPtr))
 		{
@@ -1065,6 +1524,9 @@ void USettingsWidget::TryRebindDeferredContexts()
 // Add setting on UI.
 void USettingsWidget::AddSetting(FSettingsPicker& Setting)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::AddSetting);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_AddSetting);
+
 	const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
 	if (!ChosenData)
 	{
@@ -1078,7 +1540,13 @@ void USettingsWidget::AddSetting(FSettingsPicker& Setting)
 		AddColumn(GetColumnIndexBySetting(PrimaryData.Tag));
 	}
 
-	USettingSubWidget* SettingSubWidget = CreateSettingSubWidget(PrimaryData, ChosenData->GetSubWidgetClass());
+	// Chosen types are shown by native Slate rows instead of their Blueprint sub-widgets
+	const FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	const int32 RowIndex = RowStore.FindIndex(PrimaryData.Tag.GetTagName());
+	const ESettingArchetype Archetype = RowStore.IsValidIndex(RowIndex) ? RowStore.GetArchetype(RowIndex) : ESettingArchetype::None;
+	const TSubclassOf<USettingSubWidget> SubWidgetClass = USettingSlateRow::IsSlateRowArchetype(Archetype) ? USettingSlateRow::StaticClass() : ChosenData->GetSubWidgetClass();
+
+	USettingSubWidget* SettingSubWidget = CreateSettingSubWidget(PrimaryData, SubWidgetClass);
 	checkf(SettingSubWidget, TEXT("ERROR: [%i] %s:\n'SettingSubWidget' is null!"), __LINE__, *FString(__FUNCTION__));
 	SettingSubWidget->OnAddSetting(Setting);
 }
@@ -1090,34 +1558,43 @@ void USettingsWidget::AddSetting(FSettingsPicker& Setting)
 // Returns the index of column for a Setting by specified tag or -1 if not found
 int32 USettingsWidget::GetColumnIndexBySetting(const FSettingTag& SettingTag) const
 {
-	int32 ColumnIndex = 0;
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
-	{
-		const FSettingsPrimary& PrimaryData = RowIt.Value.PrimaryData;
-		if (PrimaryData.bStartOnNextColumn)
-		{
-			++ColumnIndex;
-		}
-
-		if (PrimaryData.Tag == SettingTag)
-		{
-			return ColumnIndex;
-		}
-	}
-
-	return INDEX_NONE;
+	const FSettingsRowStore& RowStore = SettingsEngineInternal.GetRowStore();
+	const int32 RowIndex = RowStore.FindIndex(SettingTag.GetTagName());
+	return RowStore.IsValidIndex(RowIndex) ? RowStore.GetColumnIndex(RowIndex) : INDEX_NONE;
 }
 
 // Creates new column on specified index
 void USettingsWidget::AddColumn(int32 ColumnIndex)
 {
 	USettingColumn* NewColumn = CreateWidget<USettingColumn>(this, USettingsDataAsset::Get().GetColumnClass());
+	INC_DWORD_STAT(STAT_SWC_WidgetsCreated);
 	NewColumn->SetSettingsWidget(this);
 	ColumnIndex = FMath::Clamp(ColumnIndex, 0, ColumnsInternal.Num());
 	ColumnsInternal.Insert(NewColumn, ColumnIndex);
 	NewColumn->OnAddSetting(FSettingsPicker());
 }
 
+/*********************************************************************************************
+ * Tooltip
+ ********************************************************************************************* */
+
+// Returns the tooltip widget shared by all settings, is created on first request
+USettingTooltip* USettingsWidget::GetSharedTooltip()
+{
+	if (SharedTooltipInternal)
+	{
+		return SharedTooltipInternal;
+	}
+
+	SharedTooltipInternal = CreateWidget<USettingTooltip>(this, USettingsDataAsset::Get().GetTooltipClass());
+	INC_DWORD_STAT(STAT_SWC_WidgetsCreated);
+	checkf(SharedTooltipInternal, TEXT("ERROR: [%i] %s:\n'SharedTooltipInternal' is null!"), __LINE__, *FString(__FUNCTION__));
+	SharedTooltipInternal->SetSettingsWidget(this);
+	SharedTooltipInternal->ApplyTheme();
+
+	return SharedTooltipInternal;
+}
+
 /*********************************************************************************************
  * Multiple Data Tables support
  ********************************************************************************************* */
@@ -1160,3 +1637,68 @@ void USettingsWidget::BindOnSettingsDataRegistryChanged()
 		SettingsDataRegistryDelegate.AddUObject(this, &ThisClass::OnSettingsDataRegistryChanged);
 	}
 }
+
+#if !UE_BUILD_SHIPPING
+// Sets Settings Data Tables to be used instead of ones registered in the Settings Data Registry
+void USettingsWidget::SetDataTablesOverride(const TArray<const USettingsDataTable*>& InDataTables)
+{
+	DataTablesOverrideInternal.Reset(InDataTables.Num());
+	for (const USettingsDataTable* DataTableIt : InDataTables)
+	{
+		DataTablesOverrideInternal.Emplace(DataTableIt);
+	}
+}
+#endif // !UE_BUILD_SHIPPING
+
+/*********************************************************************************************
+ * Deferred Apply
+ ********************************************************************************************* */
+
+// Is called at the end of the frame to apply all settings requested by USettingsWidget::ApplySettingsDeferred
+void USettingsWidget::OnEndFrameApplySettings()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(USettingsWidget::OnEndFrameApplySettings);
+	SCOPE_CYCLE_COUNTER(STAT_SWC_ApplySettings);
+
+	if (!bPendingApplySettingsInternal)
+	{
+		ClearPendingApplySettings();
+		return;
+	}
+
+	if (!USettingsDataAsset::Get().IsPartialApplySettings())
+	{
+		ApplySettings();
+		return;
+	}
+
+	const bool bApplyResolution = bPendingApplyResolutionInternal;
+	ClearPendingApplySettings();
+
+	UGameUserSettings* GameUserSettings = USettingsUtilsLibrary::GetGameUserSettings();
+	if (!GameUserSettings)
+	{
+		return;
+	}
+
+	// Apply only what is needed instead of full apply, which always reapplies the resolution
+	if (bApplyResolution)
+	{
+		constexpr bool bCheckForCommandLineOverrides = false;
+		GameUserSettings->ApplyResolutionSettings(bCheckForCommandLineOverrides);
+	}
+
+	GameUserSettings->ApplyNonResolutionSettings();
+
+	// Finish the same way the full apply does
+	GameUserSettings->RequestUIUpdate();
+	GameUserSettings->SaveSettings();
+}
+
+// Resets pending apply state and stops listening the end of the frame
+void USettingsWidget::ClearPendingApplySettings()
+{
+	bPendingApplySettingsInternal = false;
+	bPendingApplyResolutionInternal = false;
+	FCoreDelegates::OnEndFrame.RemoveAll(this);
+}
@@ -0,0 +1,49 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "SettingHandle.generated.h"
+
+/**
+ * Lightweight reference to the setting row, is resolved once by its tag and then used instead of the tag.
+ * Holds the row index together with the generation of the row store it was resolved from,
+ * so it becomes stale once the rows are rebuilt or removed and never points to another row.
+ * @see USettingsWidget::ResolveSettingHandle
+ */
+USTRUCT(BlueprintType)
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingHandle
+{
+	GENERATED_BODY()
+
+	/** Default constructor. */
+	FSettingHandle() = default;
+
+	/** Custom constructor to set all members values. */
+	FSettingHandle(int32 InIndex, uint32 InGeneration)
+		: IndexInternal(InIndex), GenerationInternal(InGeneration) {}
+
+	/** Handle that points to nothing by default. */
+	static const FSettingHandle EmptyHandle;
+
+	/** Returns the index of the row in the row store. */
+	FORCEINLINE int32 GetIndex() const { return IndexInternal; }
+
+	/** Returns the generation of the row store this handle was resolved from. */
+	FORCEINLINE uint32 GetGeneration() const { return GenerationInternal; }
+
+	/** Returns true if this handle was resolved to any row, it still might be stale. */
+	FORCEINLINE bool IsSet() const { return IndexInternal != INDEX_NONE; }
+
+	/** Compares for equality. */
+	FORCEINLINE bool operator==(const FSettingHandle& Other) const { return IndexInternal == Other.IndexInternal && GenerationInternal == Other.GenerationInternal; }
+
+	/** Creates a hash value from this handle. */
+	friend FORCEINLINE uint32 GetTypeHash(const FSettingHandle& Handle) { return HashCombine(GetTypeHash(Handle.IndexInternal), GetTypeHash(Handle.GenerationInternal)); }
+
+protected:
+	/** The index of the row in the row store. */
+	int32 IndexInternal = INDEX_NONE;
+
+	/** The generation of the row store this handle was resolved from, is never 0 for resolved handles. */
+	uint32 GenerationInternal = 0;
+};
@@ -62,3 +62,47 @@ enum class ESettingsSliderState : uint8
 	NormalThumb,
 	HoveredThumb
 };
+
+/**
+  * How settings are refreshed on UI each time the Settings Widget is opened.
+  */
+UENUM(BlueprintType)
+enum class ESettingsRefreshPolicy : uint8
+{
+	///< All settings are refreshed by their getters.
+	FullRefresh,
+	///< Only settings marked by USettingsWidget::NotifySettingChanged are refreshed.
+	DirtyOnly
+};
+
+/**
+  * How the Settings Widget and its columns cache their Slate content, so it's not repainted every frame while nothing is changed.
+  */
+UENUM(BlueprintType)
+enum class ESettingsInvalidationMode : uint8
+{
+	///< Content is painted every frame.
+	None,
+	///< Content is wrapped into the invalidation panel that caches its draw elements until any widget inside is invalidated.
+	InvalidationPanel,
+	///< Content is wrapped into the retainer panel that renders it to the texture only when any widget inside is invalidated.
+	RetainerPanel
+};
+
+/**
+  * Types of settings that can be shown by lightweight native Slate rows instead of their Blueprint sub-widgets.
+  * Custom widgets are not listed, since they are always Blueprint sub-widgets.
+  */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ESettingsSlateRowTypes : uint8
+{
+	None = 0 UMETA(Hidden),
+	Button = 1 << 0,
+	Checkbox = 1 << 1,
+	Combobox = 1 << 2,
+	Slider = 1 << 3,
+	TextLine = 1 << 4,
+	UserInput = 1 << 5
+};
+
+ENUM_CLASS_FLAGS(ESettingsSlateRowTypes)
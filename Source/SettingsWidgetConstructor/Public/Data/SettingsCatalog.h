@@ -0,0 +1,108 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Engine/DataAsset.h"
+//---
+#include "Data/SettingsRow.h"
+//---
+#include "SettingsCatalog.generated.h"
+
+class USettingsDataTable;
+
+/**
+ * Precomputed layout of the merged settings, each element is the data of the row with the same index.
+ * @see FSettingsRowIndex
+ */
+USTRUCT(BlueprintType)
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsCatalogLayout
+{
+	GENERATED_BODY()
+
+	/** The index of the column each row is added to. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<int32> ColumnIndices;
+
+	/** The start of dependencies of each row in DependencyIndices, contains one more element than rows. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<int32> DependencyOffsets;
+
+	/** Indices of rows to update once the row is changed, are grouped by rows. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<int32> DependencyIndices;
+
+	/** Returns true if this layout is baked for specified amount of rows. */
+	FORCEINLINE bool IsValidFor(int32 RowsNum) const { return ColumnIndices.Num() == RowsNum && DependencyOffsets.Num() == RowsNum + 1; }
+};
+
+/**
+ * Contains all setting rows pre-merged from Settings Data Tables, so the widget doesn't have to walk the Data Registry and sort rows on each construct.
+ * Is rebuilt on every save of this asset (including cook), so the cooked game loads the whole catalog with its package at once.
+ * Is taken into account only when baked from exactly the same tables as currently registered ones with the same rows,
+ * otherwise (e.g: DLC tables are added or a table is patched after the cook) settings are generated from live tables.
+ * @see USettingsDataAsset::SettingsCatalogInternal
+ */
+UCLASS(BlueprintType)
+class SETTINGSWIDGETCONSTRUCTOR_API USettingsCatalog : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the baked rows in their final order. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	void GetSettingRows(TMap<FName, FSettingsPicker>& OutSettingRows) const;
+
+	/** Returns amount of baked rows. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE int32 GetRowsNum() const { return RowsInternal.Num(); }
+
+	/** Returns the precomputed layout of baked rows. */
+	const FORCEINLINE FSettingsCatalogLayout& GetLayout() const { return LayoutInternal; }
+
+	/** Returns true if this catalog is baked from exactly specified tables and their rows are not changed since then, so it can be used instead of them.
+	 * Is always false in the editor, where tables can be changed after the catalog is saved. */
+	bool IsUpToDate(const TSet<const USettingsDataTable*>& DataTables) const;
+
+#if WITH_EDITOR
+	/** Merges all source tables into this catalog and precomputes their layout. */
+	void RebuildCatalog();
+#endif
+
+	/*********************************************************************************************
+	 * Protected properties
+	 ********************************************************************************************* */
+protected:
+	/** Tables to bake into this catalog, if empty then all tables registered in the Settings Data Registry are baked. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Source Tables"))
+	TArray<TSoftObjectPtr<const USettingsDataTable>> SourceTablesInternal;
+
+	/** Paths of all tables the catalog is baked from, is used to detect tables added after the cook. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Baked Tables"))
+	TArray<FSoftObjectPath> BakedTablesInternal;
+
+	/** The rows hash of each table in BakedTablesInternal, is used to detect tables whose rows are changed after the cook.
+	 * @see USettingsDataTable::GetRowsHash */
+	UPROPERTY(VisibleAnywhere, Category = "Settings Widget Constructor", meta = (DisplayName = "Baked Tables Hashes"))
+	TArray<uint32> BakedTablesHashesInternal;
+
+	/** Tags names of baked rows, each is the key of the row with the same index. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Row Names"))
+	TArray<FName> RowNamesInternal;
+
+	/** All baked rows in their final order, with 'Show Next To Setting Override' already resolved. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Rows"))
+	TArray<FSettingsPicker> RowsInternal;
+
+	/** Precomputed columns and dependencies of baked rows. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Layout"))
+	FSettingsCatalogLayout LayoutInternal;
+
+	/*********************************************************************************************
+	 * Internal
+	 ********************************************************************************************* */
+protected:
+#if WITH_EDITOR
+	/** Is overridden to rebuild the catalog on each save, so cooked catalog always matches the tables. */
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#endif
+};
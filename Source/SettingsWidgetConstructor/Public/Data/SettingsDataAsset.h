@@ -4,6 +4,7 @@
 
 #include "Engine/DeveloperSettings.h"
 //---
+#include "Data/SettingTypes.h"
 #include "Data/SettingsThemeData.h"
 //---
 #include "Templates/SubclassOf.h"
@@ -11,6 +12,7 @@
 #include "SettingsDataAsset.generated.h"
 
 class USettingsDataTable;
+class USettingsCatalog;
 class UDataRegistry;
 
 /**
@@ -87,6 +89,21 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
 	FORCEINLINE bool IsAutoFocusOnOpen() const { return bAutoFocusOnOpenInternal; }
 
+	/** Returns true if settings changed with 'Apply Immediately' should be applied partially (resolution and non-resolution settings separately) instead of full Game User Settings apply. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE bool IsPartialApplySettings() const { return bPartialApplySettingsInternal; }
+
+	/** Returns how settings are refreshed on UI each time the Settings Widget is opened. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE ESettingsRefreshPolicy GetOpenRefreshPolicy() const { return OpenRefreshPolicyInternal; }
+
+	/** Returns how the Settings Widget and its columns cache their Slate content. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE ESettingsInvalidationMode GetInvalidationMode() const { return InvalidationModeInternal; }
+
+	/** Returns types of settings that are shown by native Slate rows instead of their Blueprint sub-widgets. */
+	FORCEINLINE ESettingsSlateRowTypes GetSlateRowTypes() const { return static_cast<ESettingsSlateRowTypes>(SlateRowTypesInternal); }
+
 	/** Returns the width and height of the settings widget in percentages of an entire screen. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
 	const FORCEINLINE FVector2D& GetSettingsPercentSize() const { return SettingsPercentSizeInternal; }
@@ -132,6 +149,10 @@ public:
 	UDataRegistry* GetSettingsDataRegistry() const;
 	const TSoftObjectPtr<UDataRegistry>& GetSettingsDataRegistrySoft() const { return SettingsDataRegistryInternal; }
 
+	/** Returns the catalog with all settings pre-merged from Settings Data Tables, is optional and might be null. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	const USettingsCatalog* GetSettingsCatalog() const;
+
 	/*********************************************************************************************
 	 * Protected properties
 	 ********************************************************************************************* */
@@ -184,6 +205,27 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Auto Focus On Open", ShowOnlyInnerProperties))
 	bool bAutoFocusOnOpenInternal;
 
+	/** If true, settings changed with 'Apply Immediately' will apply only non-resolution settings, and the resolution only when any of changed settings has 'Apply Resolution' enabled.
+	 * Is cheaper than full Game User Settings apply, which can reset the resolution and scalability, is config property. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Partial Apply Settings", ShowOnlyInnerProperties))
+	bool bPartialApplySettingsInternal = false;
+
+	/** How settings are refreshed on UI each time the Settings Widget is opened, is config property.
+	 * 'Dirty Only' refreshes only settings marked by USettingsWidget::NotifySettingChanged, so owners have to notify about changes made outside of the widget. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Open Refresh Policy", ShowOnlyInnerProperties))
+	ESettingsRefreshPolicy OpenRefreshPolicyInternal = ESettingsRefreshPolicy::FullRefresh;
+
+	/** How the Settings Widget and its columns cache their Slate content, so the deep settings tree is not repainted every frame while nothing is changed, is config property.
+	 * Is taken into account on next rebuild of the widget, 'Retainer Panel' also renders settings to the texture, so prefer 'Invalidation Panel' if any issue. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Invalidation Mode", ShowOnlyInnerProperties))
+	ESettingsInvalidationMode InvalidationModeInternal = ESettingsInvalidationMode::None;
+
+	/** Types of settings that are shown by lightweight native Slate rows styled by the theme data, instead of their Blueprint sub-widgets, is config property.
+	 * Is cheaper to construct for large menus, but Blueprint events of sub-widgets are not called for such rows, so keep Blueprint sub-widgets for custom looks.
+	 * @see USettingSlateRow */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Slate Row Types", Bitmask, BitmaskEnum = "/Script/SettingsWidgetConstructor.ESettingsSlateRowTypes", ShowOnlyInnerProperties))
+	int32 SlateRowTypesInternal = 0;
+
 	/** The width and height of the settings widget in percentages of an entire screen. Is clamped between 0 and 1, is config property. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Settings Percent Size", ClampMin = "0", ClampMax = "1", ShowOnlyInnerProperties))
 	FVector2D SettingsPercentSizeInternal;
@@ -228,6 +270,11 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Settings Data Registry", ShowOnlyInnerProperties))
 	TSoftObjectPtr<UDataRegistry> SettingsDataRegistryInternal;
 
+	/** The optional catalog with all settings pre-merged from Settings Data Tables, is baked on its save and cook, is config property.
+	 * If set, the cooked game takes settings from it instead of generating them from tables, unless other tables are registered. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Settings Catalog", ShowOnlyInnerProperties))
+	TSoftObjectPtr<const USettingsCatalog> SettingsCatalogInternal;
+
 	/*********************************************************************************************
 	 * Internal
 	 ********************************************************************************************* */
@@ -24,7 +24,29 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
 	void GetSettingRows(TMap<FName, struct FSettingsRow>& OutRows) const;
 
+	/** Returns the version of rows of this table, is increased on each change of its rows, e.g: on edit in PIE or reimport.
+	 * @see FSettingsSharedCatalog::IsUpToDate */
+	FORCEINLINE uint32 GetRowsVersion() const { return RowsVersionInternal; }
+
+	/** Returns the hash of exported rows of this table, is the same in the editor and cooked game for the same rows.
+	 * Is computed once per rows version, so it's cheap to check it again.
+	 * @see USettingsCatalog::IsUpToDate */
+	uint32 GetRowsHash() const;
+
 protected:
+	/** The version of rows of this table, is not saved since it only tracks changes made after the load. */
+	uint32 RowsVersionInternal = 0;
+
+	/** The cached hash of exported rows and the rows version it's computed for. */
+	mutable TOptional<uint32> RowsHashInternal;
+	mutable uint32 RowsHashVersionInternal = 0;
+
+	/** Is overridden to start tracking changes of rows of this table. */
+	virtual void PostInitProperties() override;
+
+	/** Is bound on any change of this data table to increase the version of its rows. */
+	void OnRowsChanged();
+
 #if WITH_EDITOR
 	/** Called on every change in this data table to automatic set the key name by specified setting tag. */
 	virtual void OnThisDataTableChanged(FName RowKey, const uint8& RowData) override;
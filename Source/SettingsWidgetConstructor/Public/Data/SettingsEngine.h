@@ -0,0 +1,278 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Data/SettingsRow.h"
+#include "Data/SettingsRowStore.h"
+//---
+#include "Templates/Function.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+struct FSettingsSharedCatalog;
+class USettingsDataTable;
+
+/**
+ * The result of writing the value into the setting row.
+ */
+enum class ESettingWriteResult : uint8
+{
+	/** The value is stored and the setter is called. */
+	Changed,
+	/** The value is the same as already stored, so nothing is called. */
+	Redundant,
+	/** The value can't be set at all, e.g: empty user input or invalid combobox index. */
+	Rejected
+};
+
+/**
+ * Headless model of settings without any UI: owns bound rows of the catalog, gets and sets their typed values,
+ * propagates changes to dependent settings and persists them to configs of their owners.
+ * Is used where the Settings Widget can't or shouldn't be created, e.g: by dedicated servers with '-nullrhi', bots, commandlets and automation.
+ * Is also owned by each Settings Widget, which binds the same rows to its sub-widgets and shows changes reported by OnSettingChanged,
+ * so setters are called only on changed values and 'Settings To Update' are refreshed after each change by the same rules everywhere.
+ * @see USettingsCatalogSubsystem::GetSettingsEngine
+ * @see USettingsWidget::SettingsEngineInternal
+ */
+class SETTINGSWIDGETCONSTRUCTOR_API FSettingsEngine
+{
+public:
+	/** Is called after the value of any setting is changed, the view can refresh its representation by specified tag. */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnSettingChanged, const FSettingTag& /*SettingTag*/);
+
+	/*********************************************************************************************
+	 * Shared helpers, are used by both the engine and the Settings Widget
+	 ********************************************************************************************* */
+public:
+	/** Binds the owner delegate of specified row and resolves functions of its owner class.
+	 * @return false if the owner is not set or its object is not initialized yet, so binding should be deferred. */
+	static bool BindOwner(FSettingsPrimary& InOutPrimary, const UObject* WorldContext);
+
+	/** Resolves owner objects of all unique owner functions of specified rows and collects functions of their classes in parallel,
+	 * so the following BindOwner calls only take cached functions. */
+	static void PrefetchOwnerFunctions(const FSettingsRowStore& RowStore, const UObject* WorldContext);
+
+	/** Saves configs of all unique owners of specified rows. */
+	static void SaveOwners(const FSettingsRowStore& RowStore, const UObject* WorldContext);
+
+	/** Applies current Game User Settings on device. */
+	static void ApplyGameUserSettings();
+
+	/** Binds getter and setter delegates of the setting data to functions of its owner object if such functions exist. */
+	template <typename TGetter, typename TSetter>
+	static void BindFunctions(const FSettingsPrimary& Primary, UObject* OwnerObject, TGetter& OutGetter, TSetter& OutSetter);
+
+	/** Binds delegates of combobox members to functions of its owner object and takes members from the owner. */
+	static void BindComboboxMembers(const FSettingsPrimary& Primary, UObject* OwnerObject, FSettingsCombobox& InOutData);
+
+	/** Typed getters of the row value, return the value of its getter if bound, otherwise the stored one. */
+	static bool GetCheckboxValue(const FSettingsPicker& Row);
+	static int32 GetComboboxIndex(const FSettingsPicker& Row);
+	static void GetComboboxMembers(const FSettingsPicker& Row, TArray<FText>& OutMembers);
+	static double GetSliderValue(const FSettingsPicker& Row);
+	static void GetTextLineValue(const FSettingsPicker& Row, FText& OutText);
+	static FName GetUserInputValue(const FSettingsPicker& Row);
+
+	/** Calls the setter of the button row. */
+	static void PressButton(const FSettingsPicker& Row);
+
+	/** Typed setters of the row value, store the value and call its setter only if it differs from the stored one.
+	 * Redundant writes are not counted here, since the caller decides whether they are tracked. */
+	static ESettingWriteResult SetCheckboxValue(FSettingsPicker& InOutRow, bool bNewValue);
+	static ESettingWriteResult SetComboboxIndex(FSettingsPicker& InOutRow, int32 NewValue);
+	static ESettingWriteResult SetTextLineValue(FSettingsPicker& InOutRow, const FText& NewValue);
+
+	/** Sets the slider value, it's clamped to [0...1] and nearly equal values are treated as the same one, so the stored value is returned then. */
+	static ESettingWriteResult SetSliderValue(FSettingsPicker& InOutRow, double& InOutValue);
+
+	/** Sets the user input, it's limited by the max characters number of the row, so the limited value is returned. */
+	static ESettingWriteResult SetUserInputValue(FSettingsPicker& InOutRow, FName& InOutValue);
+
+	/*********************************************************************************************
+	 * Lifetime
+	 ********************************************************************************************* */
+public:
+	/** Takes rows of specified tables and binds all of them to their owners.
+	 * @param InWorldContext Any object of the world whose owners are bound, e.g: the game instance.
+	 * @param DataTables Tables to take rows from, all Settings Data Tables of the registry are taken if empty. */
+	void Initialize(const UObject* InWorldContext, const TSet<const USettingsDataTable*>& DataTables);
+
+	/** Takes rows of specified catalog without binding them, so the view binds them by itself, e.g: the Settings Widget binds rows together with their sub-widgets.
+	 * @param InWorldContext Any object of the world whose owners are bound.
+	 * @param InSharedCatalog The catalog to take rows from. */
+	void InitializeRows(const UObject* InWorldContext, const TSharedRef<const FSettingsSharedCatalog>& InSharedCatalog);
+
+	/** Releases all rows and their bindings. */
+	void Reset();
+
+	/** Returns true if rows are taken and ready to be used, is also true when given tables have no rows, so it's not initialized again. */
+	FORCEINLINE bool IsInitialized() const { return bInitialized; }
+
+	/** Returns true if none of tables the rows are taken from was destroyed or changed since then. */
+	bool IsUpToDate() const;
+
+	/** Returns amount of settings. */
+	FORCEINLINE int32 Num() const { return RowStore.Num(); }
+
+	/** Returns the index over all rows. */
+	FORCEINLINE const FSettingsRowStore& GetRowStore() const { return RowStore; }
+	FORCEINLINE FSettingsRowStore& GetRowStore() { return RowStore; }
+
+	/** Returns own rows by their tags, are mutable for the view to bind them. */
+	FORCEINLINE const TMap<FName, FSettingsPicker>& GetRows() const { return Rows; }
+	FORCEINLINE TMap<FName, FSettingsPicker>& GetRows() { return Rows; }
+
+	/** Returns the delegate that is called after the value of any setting is changed. */
+	FORCEINLINE FOnSettingChanged& OnSettingChanged() { return OnSettingChangedDelegate; }
+
+	/** Attempts to bind rows whose owners were not initialized yet on previous tries.
+	 * @return amount of rebound rows, their values are refreshed from configs. */
+	int32 TryRebindDeferred();
+
+	/*********************************************************************************************
+	 * Values
+	 ********************************************************************************************* */
+public:
+	/** Returns the current value of specified setting in a string format, is taken from its getter if bound.
+	 * @return false if there is no such setting or its type has no value, e.g: button. */
+	bool GetSettingValue(FName TagName, FString& OutValue) const;
+
+	/** Sets the value of specified setting in a string format, it's converted to the setting type.
+	 * @return true if the value is changed, so its setter is called. */
+	bool SetSettingValue(FName TagName, const FString& Value);
+
+	/** Sets values of many settings at once, their dependent settings are refreshed once when all of them are set.
+	 * @return amount of changed settings. */
+	int32 SetSettingsBatch(const TMap<FName, FString>& SettingValues);
+
+	/** Sets the value of specified row in a string format as SetSettingValue does, but doesn't apply settings, so the caller decides when to apply them. */
+	ESettingWriteResult WriteRowValue(int32 RowIndex, const FString& Value);
+
+	/** Writes the value of specified row by given function, e.g: by one of typed setters above.
+	 * The row is synced with its getter before, so the value is compared with the actual one of the owner,
+	 * then the redundant write is counted or the change is reported and its dependent settings are refreshed.
+	 * @return the result of the write function or 'Rejected' if there is no such row. */
+	ESettingWriteResult WriteRow(int32 RowIndex, TFunctionRef<ESettingWriteResult(FSettingsPicker&)> WriteFunction);
+
+	/** Starts the batch, dependent settings of rows changed during it are refreshed once when the outermost batch is finished. */
+	void BeginBatch();
+
+	/** Finishes the batch started by BeginBatch. */
+	void EndBatch();
+
+	/** Returns true while settings are set by the batch. */
+	FORCEINLINE bool IsBatchActive() const { return BatchDepth > 0; }
+
+	/** Takes values of specified rows from their getters and sets them, so their setters, views and dependent settings are updated in turn.
+	 * @param bLoadFromConfig If true, configs of owners of these rows are reloaded first. */
+	void RefreshSettings(TConstArrayView<int32> RowIndices, bool bLoadFromConfig = false);
+
+	/** Refreshes settings that depend on specified row, are taken from its 'Settings To Update', is postponed until the batch is finished. */
+	void RefreshDependencies(int32 RowIndex);
+
+	/** Returns the total amount of writes skipped since the value is the same as already set. */
+	FORCEINLINE int32 GetRedundantWritesNum() const { return RedundantWritesNum; }
+
+	/** Reloads configs of all owners and refreshes all settings by their getters. */
+	void ReloadSettings();
+
+	/** Applies current settings on device. */
+	void ApplySettings();
+
+	/** Applies current settings and saves all owners into their configs. */
+	void SaveSettings();
+
+	/*********************************************************************************************
+	 * Internal
+	 ********************************************************************************************* */
+protected:
+	/** Binds getter and setter delegates of specified row to its owner.
+	 * @return false if the owner is not initialized yet. */
+	bool BindRow(int32 RowIndex);
+
+	/** Returns the current value of specified row, see GetSettingValue. */
+	bool GetRowValue(int32 RowIndex, FString& OutValue) const;
+
+	/** Converts the string value to the type of specified archetype and sets it by its typed setter. */
+	static ESettingWriteResult SetStringValue(FSettingsPicker& InOutRow, ESettingArchetype Archetype, const FString& Value);
+
+	/** Sets the value of specified row without syncing it first, is used to refresh the row by the value of its own getter. */
+	bool SetRowValue(int32 RowIndex, const FString& Value);
+
+	/** Takes the value of specified row from its getter into the row, so the new value is compared with the actual value of the owner instead of the cached one.
+	 * Is called before the value is set from outside, since the owner might be changed directly, e.g: by game code.
+	 * @return true if the stored value was outdated. */
+	bool SyncRowValue(int32 RowIndex);
+
+	/** Counts the redundant write or reports the change of specified row.
+	 * @return given write result. */
+	ESettingWriteResult CommitRowWrite(int32 RowIndex, ESettingWriteResult WriteResult);
+
+	/** Is called when the value of specified row is changed to notify views and refresh its dependent settings. */
+	void OnRowChanged(int32 RowIndex);
+
+	/** Takes values of specified rows from their getters and sets them, so their setters and dependent settings are updated in turn. */
+	void RefreshRows(TConstArrayView<int32> RowIndices);
+
+	/*********************************************************************************************
+	 * Data
+	 ********************************************************************************************* */
+protected:
+	/** The catalog the rows are taken from, is shared with Settings Widgets of the same tables. */
+	TSharedPtr<const FSettingsSharedCatalog> SharedCatalog = nullptr;
+
+	/** Own copy of rows bound to their owners. */
+	TMap<FName/*Tag*/, FSettingsPicker/*Row*/> Rows;
+
+	/** Dense index over own rows. */
+	FSettingsRowStore RowStore;
+
+	/** The object whose world is used to find owners of settings. */
+	TWeakObjectPtr<const UObject> WorldContext = nullptr;
+
+	/** Indices of rows whose owners are not initialized yet, so they are bound later. */
+	TArray<int32> DeferredRowIndices;
+
+	/** Indices of rows changed during current batch, their dependent settings are refreshed once the batch is finished. */
+	TArray<int32> BatchChangedIndices;
+
+	/** Is not zero while the batch of settings is being set. */
+	int32 BatchDepth = 0;
+
+	/** How deep dependent settings are refreshed right now, is limited to break cyclic dependencies. */
+	int32 PropagationDepth = 0;
+
+	/** The max depth of refreshed dependent settings during the frame it was tracked on, is shown in 'stat SettingsWidgetConstructor'. */
+	int32 FramePropagationDepth = 0;
+
+	/** The frame on which the max depth of refreshed dependent settings was tracked. */
+	uint64 PropagationDepthFrame = 0;
+
+	/** The total amount of writes skipped since the value is the same as already set. */
+	int32 RedundantWritesNum = 0;
+
+	/** Is true if any changed setting has to be applied immediately. */
+	bool bPendingApply = false;
+
+	/** Is true once rows are taken, even if there are no rows at all. */
+	bool bInitialized = false;
+
+	/** Is called after the value of any setting is changed. */
+	FOnSettingChanged OnSettingChangedDelegate;
+};
+
+// Binds getter and setter delegates of the setting data to functions of its owner object if such functions exist
+template <typename TGetter, typename TSetter>
+void FSettingsEngine::BindFunctions(const FSettingsPrimary& Primary, UObject* OwnerObject, TGetter& OutGetter, TSetter& OutSetter)
+{
+	const FName GetterFunctionName = Primary.Getter.FunctionName;
+	if (Primary.HasOwnerFunction(GetterFunctionName))
+	{
+		OutGetter.BindUFunction(OwnerObject, GetterFunctionName);
+	}
+
+	const FName SetterFunctionName = Primary.Setter.FunctionName;
+	if (Primary.HasOwnerFunction(SetterFunctionName))
+	{
+		OutSetter.BindUFunction(OwnerObject, SetterFunctionName);
+	}
+}
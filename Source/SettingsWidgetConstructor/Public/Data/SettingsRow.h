@@ -77,6 +77,12 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPrimary
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	bool bApplyImmediately = false;
 
+	/** If true, changing this setting requires the screen resolution to be reapplied (e.g: Fullscreen Mode, Screen Resolution).
+	 * Is taken into account only when 'Partial Apply Settings' is enabled in the Settings Data Asset, otherwise all settings are always applied.
+	 * @see USettingsWidget::ApplySettingsDeferred */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bApplyImmediately"))
+	bool bApplyResolution = false;
+
 	/** Contains tags of settings which are needed to update after change of this setting. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (Categories = "Settings"))
 	FGameplayTagContainer SettingsToUpdate = FGameplayTagContainer::EmptyContainer;
@@ -91,12 +97,16 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPrimary
 	/** Created widget of the chosen setting (button, checkbox, combobox, slider, text line, user input). */
 	TWeakObjectPtr<class USettingSubWidget> SettingSubWidget = nullptr;
 
-	/** Contains all cached functions of the Owner object. */
-	TArray<FName> OwnerFunctionList;
+	/** Contains all cached functions of the Owner object, is shared by all rows and players with the same owner class.
+	 * @see USettingsCatalogSubsystem::GetOwnerFunctions */
+	TSharedPtr<const TSet<FName>> OwnerFunctionList = nullptr;
 
 	/** Returns true if is valid. */
 	FORCEINLINE bool IsValid() const { return Tag.IsValid(); }
 
+	/** Returns true if the Owner object has the function with specified name. */
+	FORCEINLINE bool HasOwnerFunction(FName FunctionName) const { return OwnerFunctionList && OwnerFunctionList->Contains(FunctionName); }
+
 	/** Compares for equality.
 	* @param Other The other object being compared. */
 	bool operator==(const FSettingsPrimary& Other) const;
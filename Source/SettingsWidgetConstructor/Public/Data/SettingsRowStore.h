@@ -0,0 +1,228 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Data/SettingFunction.h"
+#include "Data/SettingHandle.h"
+#include "Data/SettingTag.h"
+
+struct FSettingsPicker;
+struct FSettingsCatalogLayout;
+class USettingSubWidget;
+
+/**
+ * Archetype of the setting row, is the compact form of FSettingsPicker::SettingsType.
+ */
+enum class ESettingArchetype : uint8
+{
+	None,
+	Button,
+	Checkbox,
+	Combobox,
+	Slider,
+	TextLine,
+	UserInput,
+	CustomWidget
+};
+
+/**
+ * Flags of the setting row that are read by bulk passes over all rows.
+ */
+enum class ESettingRowFlags : uint8
+{
+	None = 0,
+	ApplyImmediately = 1 << 0,
+	ApplyResolution = 1 << 1,
+	StartOnNextColumn = 1 << 2,
+	CanUpdate = 1 << 3
+};
+
+ENUM_CLASS_FLAGS(ESettingRowFlags);
+
+/**
+ * Immutable dense structure-of-arrays index over merged setting rows, is the same for all players.
+ * Is built once per shared catalog, while each player only binds own rows to it, see FSettingsRowStore.
+ * @see FSettingsSharedCatalog::Index
+ */
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsRowIndex
+{
+	/** Creates the index of specified rows, their order is kept.
+	 * Pure data of each row is prepared in parallel, while data that depends on previous rows is committed in rows order afterwards.
+	 * @param InRows The rows to index, each store bound to this index has to keep the same rows in the same order.
+	 * @param PrecomputedLayout If set and baked for the same amount of rows, its columns and dependencies are taken instead of computing them. */
+	static TSharedRef<const FSettingsRowIndex> Make(const TMap<FName, FSettingsPicker>& InRows, const FSettingsCatalogLayout* PrecomputedLayout = nullptr);
+
+	/** Returns amount of indexed rows. */
+	FORCEINLINE int32 Num() const { return Tags.Num(); }
+
+	/** Returns true if specified row has any of given flags. */
+	FORCEINLINE bool HasFlag(int32 RowIndex, ESettingRowFlags Flag) const { return EnumHasAnyFlags(Flags[RowIndex], Flag); }
+
+	/** Returns the index of the row by its tag name or INDEX_NONE if not found. */
+	int32 FindIndex(FName TagName) const;
+
+	/** Returns indices of rows whose tags match any of specified tags, sorted by rows order.
+	 * Matches the same rows as FGameplayTag::MatchesAny does, so parent tags match all their children. */
+	void FindIndicesByTags(const FGameplayTagContainer& InTags, TArray<int32>& OutRowIndices) const;
+
+	/** Returns indices of rows to update once specified row is changed, are resolved from its 'Settings To Update'. */
+	TConstArrayView<int32> GetDependencies(int32 RowIndex) const;
+
+	/** Returns bytes allocated by all arrays and maps of this index. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Copies columns and dependencies of this index into specified layout, so next indices of the same rows don't compute them again. */
+	void ExportLayout(FSettingsCatalogLayout& OutLayout) const;
+
+	/*********************************************************************************************
+	 * Parallel arrays, each element is the data of the row with the same index
+	 ********************************************************************************************* */
+public:
+	/** The tag of each row. */
+	TArray<FSettingTag> Tags;
+
+	/** The archetype of each row. */
+	TArray<ESettingArchetype> Archetypes;
+
+	/** The flags of each row. */
+	TArray<ESettingRowFlags> Flags;
+
+	/** The index of the column each row is added to. */
+	TArray<int32> ColumnIndices;
+
+	/** The index of the owner function of each row in OwnerRowIndices, is INDEX_NONE if owner is not set. */
+	TArray<int32> OwnerIndices;
+
+	/** The getter and setter functions of each row. */
+	TArray<FSettingFunctionPicker> Getters;
+	TArray<FSettingFunctionPicker> Setters;
+
+	/** The first row of each unique owner function, its bound owner delegate is used to obtain the owner object. */
+	TArray<int32> OwnerRowIndices;
+
+protected:
+	/** The start of dependencies of each row in DependencyIndices. */
+	TArray<int32> DependencyOffsets;
+
+	/** Indices of all dependent rows, are grouped by rows. */
+	TArray<int32> DependencyIndices;
+
+	/** The row index by its tag name. */
+	TMap<FName, int32> IndexByName;
+
+	/** Indices of rows by each tag that matches them: their own tag and all its parents. */
+	TMap<FName, TArray<int32>> IndicesByMatchingTag;
+};
+
+/**
+ * Per-player rows of the Settings Engine bound to the immutable index of their shared catalog.
+ * Rows themselves stay in the Settings Engine, while bulk passes scan compact parallel arrays of the shared index instead of whole rows,
+ * so only row pointers and created sub-widgets are held by each player.
+ * Is rebuilt every time the rows are cached, so any row index is valid only until the next rebuild.
+ * Rows are referenced by pointers into the map given on rebuild, so rows must not be added to or removed from that map until the next rebuild or reset,
+ * it is guarded by checks on each row access, see FSettingsRowStore::GetRow.
+ * Each rebuild gets the new generation that is unique across all stores, so handles of previous rows are detected as stale.
+ * @see FSettingsEngine::Rows
+ */
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsRowStore
+{
+	/** The minimal amount of rows to prepare them in parallel, smaller stores are built on the calling thread since tasks would cost more. */
+	static constexpr int32 MinParallelRowsNum = 64;
+
+	/** Returns the archetype by specified name of the FSettingsPicker member, e.g: 'Checkbox'. */
+	static ESettingArchetype GetArchetypeByName(FName SettingsType);
+
+	/** Rebuilds the store by specified rows with own new index, their order is kept.
+	 * @param InRows The rows to index, the map must not be changed until the next rebuild, since rows are referenced by pointers.
+	 * @param PrecomputedLayout If set and baked for the same amount of rows, its columns and dependencies are taken instead of computing them. */
+	void Build(TMap<FName, FSettingsPicker>& InRows, const FSettingsCatalogLayout* PrecomputedLayout = nullptr);
+
+	/** Rebuilds the store by specified rows bound to already built index, so nothing but row pointers is computed.
+	 * @param InRows The rows to bind, have to be the same rows in the same order as the index is made of, e.g: a copy of the shared catalog rows.
+	 * @param InIndex The index to bind rows to, is shared with other stores of the same rows. */
+	void Build(TMap<FName, FSettingsPicker>& InRows, const TSharedRef<const FSettingsRowIndex>& InIndex);
+
+	/** Clears all arrays, all handles resolved before become stale. */
+	void Reset();
+
+	/** Returns the generation of current rows, is changed on every rebuild and reset. */
+	FORCEINLINE uint32 GetGeneration() const { return Generation; }
+
+	/** Returns amount of stored rows. */
+	FORCEINLINE int32 Num() const { return Rows.Num(); }
+
+	/** Returns true if specified row index is valid. */
+	FORCEINLINE bool IsValidIndex(int32 RowIndex) const { return Rows.IsValidIndex(RowIndex); }
+
+	/** Returns true if this store is built for specified rows and none of them was added or removed since then. */
+	bool IsBuiltFor(const TMap<FName, FSettingsPicker>& InRows) const;
+
+	/** Returns the row itself by its index, is used to read and write the rest of its data.
+	 * Checks the rows map was not changed since the rebuild, otherwise the referenced row would be dangling. */
+	FSettingsPicker& GetRow(int32 RowIndex) const;
+
+	/** Returns the immutable index these rows are bound to, is shared with other stores of the same rows. */
+	FORCEINLINE const FSettingsRowIndex& GetIndex() const { return *Index; }
+
+	/** Returns the tag of specified row. */
+	FORCEINLINE const FSettingTag& GetTag(int32 RowIndex) const { return Index->Tags[RowIndex]; }
+
+	/** Returns the archetype of specified row. */
+	FORCEINLINE ESettingArchetype GetArchetype(int32 RowIndex) const { return Index->Archetypes[RowIndex]; }
+
+	/** Returns the index of the column specified row is added to. */
+	FORCEINLINE int32 GetColumnIndex(int32 RowIndex) const { return Index->ColumnIndices[RowIndex]; }
+
+	/** Returns the getter function of specified row. */
+	FORCEINLINE const FSettingFunctionPicker& GetGetter(int32 RowIndex) const { return Index->Getters[RowIndex]; }
+
+	/** Returns the setter function of specified row. */
+	FORCEINLINE const FSettingFunctionPicker& GetSetter(int32 RowIndex) const { return Index->Setters[RowIndex]; }
+
+	/** Returns the first row of each unique owner function. */
+	FORCEINLINE TConstArrayView<int32> GetOwnerRowIndices() const { return Index ? TConstArrayView<int32>(Index->OwnerRowIndices) : TConstArrayView<int32>(); }
+
+	/** Returns true if specified row has any of given flags. */
+	FORCEINLINE bool HasFlag(int32 RowIndex, ESettingRowFlags Flag) const { return Index->HasFlag(RowIndex, Flag); }
+
+	/** Returns the index of the row by its tag name or INDEX_NONE if not found. */
+	FORCEINLINE int32 FindIndex(FName TagName) const { return Index ? Index->FindIndex(TagName) : INDEX_NONE; }
+
+	/** Returns the handle of the row by its tag name, is empty if not found. */
+	FSettingHandle MakeHandle(FName TagName) const;
+
+	/** Returns the index of the row by specified handle or INDEX_NONE if the handle is empty, stale or resolved from another store. */
+	FORCEINLINE int32 ResolveHandle(const FSettingHandle& Handle) const { return Handle.GetGeneration() == Generation && IsValidIndex(Handle.GetIndex()) ? Handle.GetIndex() : INDEX_NONE; }
+
+	/** Returns indices of rows whose tags match any of specified tags, sorted by rows order.
+	 * Matches the same rows as FGameplayTag::MatchesAny does, so parent tags match all their children. */
+	void FindIndicesByTags(const FGameplayTagContainer& InTags, TArray<int32>& OutRowIndices) const;
+
+	/** Returns indices of rows to update once specified row is changed, are resolved from its 'Settings To Update'. */
+	FORCEINLINE TConstArrayView<int32> GetDependencies(int32 RowIndex) const { return Index ? Index->GetDependencies(RowIndex) : TConstArrayView<int32>(); }
+
+	/** Returns bytes allocated by per-player arrays of this store, the shared index is not included. */
+	SIZE_T GetAllocatedSize() const;
+
+	/*********************************************************************************************
+	 * Per-player arrays, each element is the data of the row with the same index
+	 ********************************************************************************************* */
+public:
+	/** The created sub-widget of each row, is set once the setting is added. */
+	TArray<TWeakObjectPtr<USettingSubWidget>> Widgets;
+
+protected:
+	/** The immutable index of rows, is shared with other stores of the same rows. */
+	TSharedPtr<const FSettingsRowIndex> Index = nullptr;
+
+	/** The row itself, points into the map this store is built for.
+	 * @see FSettingsRowStore::GetRow */
+	TArray<FSettingsPicker*> Rows;
+
+	/** The map of rows this store is built for, is used to check its rows were not added or removed since the rebuild. */
+	const TMap<FName, FSettingsPicker>* SourceRows = nullptr;
+
+	/** The generation of current rows, handles of other generations are stale.
+	 * @see FSettingsRowStore::ResolveHandle */
+	uint32 Generation = 0;
+};
@@ -0,0 +1,49 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Data/SettingsCatalog.h"
+//---
+#include "UObject/WeakObjectPtrTemplates.h"
+
+struct FSettingsRowIndex;
+class USettingsDataTable;
+
+/**
+ * Immutable settings merged once from Settings Data Tables, are shared by Settings Widgets of all local players.
+ * Tables are merged, and the order, tags, archetypes, flags, functions, columns and dependencies are indexed only once for all players.
+ * Each player binds own copy of rows to the shared index, since FSettingsPicker keeps bound delegates, current value and sub-widget
+ * right next to the table data, while everything bulk passes read is held once here.
+ * Is remembered with versions of its tables, so it's merged again once any table is changed, e.g: edited in PIE or reimported.
+ * @see USettingsCatalogSubsystem::GetSharedCatalog
+ */
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsSharedCatalog
+{
+	/** Merges specified tables into new catalog, takes the cooked Settings Catalog instead if it's baked from the same tables. */
+	static TSharedRef<const FSettingsSharedCatalog> Build(const TSet<const USettingsDataTable*>& InDataTables);
+
+	/** Returns true if this catalog is merged from exactly specified tables and none of them was changed since then. */
+	bool IsBuiltFrom(const TSet<const USettingsDataTable*>& InDataTables) const;
+
+	/** Returns true if none of tables this catalog is merged from was destroyed or changed since then. */
+	bool IsUpToDate() const;
+
+	/** Returns amount of merged rows. */
+	FORCEINLINE int32 Num() const { return Rows.Num(); }
+
+	/** Returns bytes allocated by all rows and the index of this catalog. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** All tables this catalog is merged from. */
+	TArray<TWeakObjectPtr<const USettingsDataTable>> DataTables;
+
+	/** The rows version of each table in DataTables at the time this catalog was merged.
+	 * @see USettingsDataTable::GetRowsVersion */
+	TArray<uint32> DataTableVersions;
+
+	/** All merged rows in their final order, are not bound to any owner, each user copies them to bind. */
+	TMap<FName, FSettingsPicker> Rows;
+
+	/** The immutable index of merged rows, each user binds own copy of rows to it. */
+	TSharedPtr<const FSettingsRowIndex> Index = nullptr;
+};
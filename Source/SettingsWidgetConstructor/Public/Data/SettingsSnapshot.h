@@ -0,0 +1,49 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+//---
+#include "SettingsSnapshot.generated.h"
+
+/**
+ * Captured values of settings, e.g: to store graphics presets like Low/Medium/High or to keep them in the user save.
+ * Each value is in a string format, as it's set by USettingsWidget::SetSettingValue, and belongs to the tag with the same index.
+ * @see USettingsWidget::CaptureSettingsSnapshot
+ */
+USTRUCT(BlueprintType)
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsSnapshot
+{
+	GENERATED_BODY()
+
+	/** Empty snapshot. */
+	static const FSettingsSnapshot EmptySnapshot;
+
+	/** Tags of captured settings. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, SaveGame, meta = (Categories = "Settings"))
+	TArray<FGameplayTag> Tags;
+
+	/** Values of captured settings in a string format. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, SaveGame)
+	TArray<FString> Values;
+
+	/** Returns amount of captured settings. */
+	FORCEINLINE int32 Num() const { return FMath::Min(Tags.Num(), Values.Num()); }
+
+	/** Returns true if nothing is captured. */
+	FORCEINLINE bool IsEmpty() const { return Num() == 0; }
+
+	/** Adds the value of specified setting. */
+	void Add(const FGameplayTag& Tag, const FString& Value);
+
+	/** Returns the captured value of specified setting or null if it's not captured. */
+	const FString* FindValue(const FGameplayTag& Tag) const;
+
+	/** Returns settings of specified snapshot which values differ from this one or are not captured here.
+	 * @param Other The snapshot to compare with, e.g: the preset to apply.
+	 * @param OutDiff Values of the other snapshot that have to be set to get it. */
+	void Diff(const FSettingsSnapshot& Other, FSettingsSnapshot& OutDiff) const;
+
+	/** Returns all captured values by their tags. */
+	void ToMap(TMap<FGameplayTag, FString>& OutSettingValues) const;
+};
@@ -0,0 +1,128 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Data/SettingTypes.h"
+//---
+#include "Styling/SlateBrush.h"
+#include "Styling/SlateTypes.h"
+#include "Templates/SharedPointer.h"
+
+class USettingsDataAsset;
+
+/**
+ * Immutable cache of Slate brushes that are built once from the theme data of the Settings Data Asset.
+ * All settings share the same brushes instead of creating own copies on every style request.
+ * Is registered as Slate Style Set, so brushes can be also found by name, e.g: 'Button.Hovered'.
+ * Also caches complete widget styles built from the same brushes, they are shared by all native Slate rows.
+ * Is rebuilt only when the Settings Data Asset is changed, it's done in place: the same Slate Style Set, brushes and styles are updated,
+ * so any pointer or reference taken from this cache stays valid until the module is shut down.
+ */
+class SETTINGSWIDGETCONSTRUCTOR_API FSettingsStyleSet
+{
+public:
+	/** The name of registered Slate Style Set. */
+	static const FName StyleSetName;
+
+	/** Returns the cache, builds it if is not built yet or was invalidated. */
+	static const FSettingsStyleSet& Get();
+
+	/** Marks the cache as outdated, so it will be rebuilt in place on next request.
+	 * Is called when the Settings Data Asset is changed. */
+	static void Invalidate();
+
+	/** Unregisters the Slate Style Set and releases all brushes, is called on module shutdown. */
+	static void Shutdown();
+
+	/** Returns the cached Slate Style Set that contains all brushes. */
+	const class ISlateStyle& GetStyle() const;
+
+	/** Returns the cached brush of the button by specified state. */
+	const FSlateBrush& GetButtonBrush(ESettingsButtonState State) const;
+
+	/** Returns the cached brush of the checkbox by specified state. */
+	const FSlateBrush& GetCheckboxBrush(ESettingsCheckboxState State) const;
+
+	/** Returns the cached brush of the slider by specified state. */
+	const FSlateBrush& GetSliderBrush(ESettingsSliderState State) const;
+
+	/** Returns the cached brush of the combobox by specified state. */
+	const FSlateBrush& GetComboboxBrush(ESettingsButtonState State) const;
+
+	/** Returns the cached brush by specified name, e.g: 'Misc.TooltipBackground'. */
+	const FSlateBrush* GetBrush(FName BrushName) const;
+
+	/** Returns the cached style of the native button. */
+	const FORCEINLINE FButtonStyle& GetButtonStyle() const { return ButtonStyleInternal; }
+
+	/** Returns the cached style of the native checkbox. */
+	const FORCEINLINE FCheckBoxStyle& GetCheckboxStyle() const { return CheckboxStyleInternal; }
+
+	/** Returns the cached style of the native combobox. */
+	const FORCEINLINE FComboBoxStyle& GetComboboxStyle() const { return ComboboxStyleInternal; }
+
+	/** Returns the cached style of the native slider. */
+	const FORCEINLINE FSliderStyle& GetSliderStyle() const { return SliderStyleInternal; }
+
+	/** Returns the cached style of the native user input. */
+	const FORCEINLINE FEditableTextBoxStyle& GetUserInputStyle() const { return UserInputStyleInternal; }
+
+	/** Returns the cached style of texts and captions. */
+	const FORCEINLINE FTextBlockStyle& GetCaptionTextStyle() const { return CaptionTextStyleInternal; }
+
+	/** Returns the cached style of all setting values, e.g: the chosen combobox member. */
+	const FORCEINLINE FTextBlockStyle& GetElementTextStyle() const { return ElementTextStyleInternal; }
+
+protected:
+	/** The Slate Style Set that owns all cached brushes. */
+	TSharedPtr<class FSlateStyleSet> StyleSetInternal = nullptr;
+
+	/** All brushes owned by the Slate Style Set by their names, are updated in place on every rebuild. */
+	TMap<FName, FSlateBrush*> BrushesByNameInternal;
+
+	/** Quick access to owned brushes, is indexed by ESettingsButtonState. */
+	TArray<const FSlateBrush*> ButtonBrushesInternal;
+
+	/** Quick access to owned brushes, is indexed by ESettingsCheckboxState. */
+	TArray<const FSlateBrush*> CheckboxBrushesInternal;
+
+	/** Quick access to owned brushes, is indexed by ESettingsSliderState. */
+	TArray<const FSlateBrush*> SliderBrushesInternal;
+
+	/** Quick access to owned brushes, is indexed by ESettingsButtonState. */
+	TArray<const FSlateBrush*> ComboboxBrushesInternal;
+
+	/** The style of the native button. */
+	FButtonStyle ButtonStyleInternal;
+
+	/** The style of the native checkbox. */
+	FCheckBoxStyle CheckboxStyleInternal;
+
+	/** The style of the native combobox. */
+	FComboBoxStyle ComboboxStyleInternal;
+
+	/** The style of the native slider. */
+	FSliderStyle SliderStyleInternal;
+
+	/** The style of the native user input. */
+	FEditableTextBoxStyle UserInputStyleInternal;
+
+	/** The style of texts and captions. */
+	FTextBlockStyle CaptionTextStyleInternal;
+
+	/** The style of all setting values. */
+	FTextBlockStyle ElementTextStyleInternal;
+
+	/** Builds all brushes from the theme data of specified Settings Data Asset, registers the Slate Style Set once it's created.
+	 * If already built, existing brushes and styles are updated in place instead of being created again. */
+	void Build(const USettingsDataAsset& SettingsDataAsset);
+
+	/** Unregisters the Slate Style Set if was registered. */
+	void Unregister();
+
+	/** Builds widget styles of native Slate rows from already cached brushes. */
+	void BuildWidgetStyles(const USettingsDataAsset& SettingsDataAsset);
+
+	/** Creates new brush by specified theme data and adds it to the Slate Style Set, or updates the brush in place if it was already added. */
+	const FSlateBrush* AddBrush(FName BrushName, const struct FSettingsThemeData& ThemeData, const FSlateColor& TintColor, class UTexture* Texture);
+};
@@ -0,0 +1,44 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Internationalization/Text.h"
+
+/**
+ * Localization helper that is shared by all settings: captions, tooltips and combobox members.
+ * Listens to the culture change to let existing widgets update their texts in place instead of rebuilding the whole menu.
+ * Nothing is cached per text: IDs are already stored by texts themselves, while display strings are always taken from texts,
+ * so they are never stale, e.g: after localization is hot-reloaded.
+ */
+class SETTINGSWIDGETCONSTRUCTOR_API FSettingsTextCache
+{
+public:
+	/** Returns the cache, is created on first request, is null once the module is shut down. */
+	static FSettingsTextCache* Get();
+
+	/** Stops listening to the culture change, is called on module shutdown, the cache is never created again. */
+	static void Shutdown();
+
+	/** Returns the ID of specified text that is the same for all cultures, e.g: '2503BD4742C4'.
+	 * Text without ID is not localized, so its string is returned instead. */
+	static FString MakeTextId(const FText& Text);
+
+	/** Default constructor, starts listening to the culture change. */
+	FSettingsTextCache();
+
+	/** Destructor, stops listening to the culture change. */
+	~FSettingsTextCache();
+
+	/** Returns the delegate that is called after the culture is changed, existing widgets refresh their texts by it. */
+	FORCEINLINE FSimpleMulticastDelegate& OnCultureChanged() { return OnCultureChangedDelegate; }
+
+protected:
+	/** Is called by the engine after the culture is changed. */
+	void HandleCultureChanged();
+
+	/** The name of the current culture, is used to notify only about actual changes. */
+	FString CurrentCulture;
+
+	/** Is called after the culture is changed. */
+	FSimpleMulticastDelegate OnCultureChangedDelegate;
+};
@@ -4,6 +4,8 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 //---
+#include "Data/SettingTypes.h"
+//---
 #include "SettingsUtilsLibrary.generated.h"
 
 /**
@@ -19,6 +21,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (WorldContext = "WorldContextObject"))
 	static class USettingsWidget* GetSettingsWidget(const UObject* WorldContextObject);
 
+	/** Returns the Settings widget of specified local player, is useful for split-screen. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	static class USettingsWidget* GetSettingsWidgetByPlayer(const class APlayerController* PlayerController);
+
+	/** Returns the Settings widget of the local player by its index in the game instance, e.g: 1 for the second split-screen player. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (WorldContext = "WorldContextObject"))
+	static class USettingsWidget* GetSettingsWidgetByPlayerIndex(const UObject* WorldContextObject, int32 LocalPlayerIndex);
+
+	/** Returns constructed Settings widgets of all local players, e.g: to apply the same change for all split-screen players. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (WorldContext = "WorldContextObject"))
+	static void GetAllSettingsWidgets(const UObject* WorldContextObject, TArray<class USettingsWidget*>& OutSettingsWidgets);
+
 	/** Returns the Game User Settings object. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (WorldContext = "OptionalWorldContext", CallableWithoutWorldContext))
 	static class UGameUserSettings* GetGameUserSettings(const UObject* OptionalWorldContext = nullptr);
@@ -28,6 +42,23 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
 	static void GenerateAllSettingRows(TMap<FName, struct FSettingsPicker>& OutSettingRows);
 
+	/** Returns all Settings Rows from specified Settings Data Tables sorted by FSettingsPrimary::ShowNextToSettingOverride.
+	 * Is used by GenerateAllSettingRows, but can be called directly for tables that are not registered, e.g: in benchmarks. */
+	static void GenerateSettingRows(const TSet<const class USettingsDataTable*>& DataTables, TMap<FName, struct FSettingsPicker>& OutSettingRows);
+
+	/** Returns the Settings Catalog if it's baked from exactly specified tables, otherwise null, so settings have to be generated from live tables.
+	 * @see USettingsDataAsset::SettingsCatalogInternal */
+	static const class USettingsCatalog* GetUpToDateCatalog(const TSet<const class USettingsDataTable*>& DataTables);
+
+	/** Returns settings of the second snapshot which values differ from the first one, e.g: what has to be set to apply the preset.
+	 * @see USettingsWidget::CaptureSettingsSnapshot */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "From,To"))
+	static void DiffSettingsSnapshots(const struct FSettingsSnapshot& From, const struct FSettingsSnapshot& To, struct FSettingsSnapshot& OutDiff);
+
+	/** Returns specified Slate content wrapped into the invalidation or retainer panel, or the content itself if the mode is 'None'.
+	 * @see USettingsDataAsset::InvalidationModeInternal */
+	static TSharedRef<SWidget> WrapInvalidationRoot(const TSharedRef<SWidget>& Content, ESettingsInvalidationMode InvalidationMode, FName DebugName);
+
 	/*********************************************************************************************
 	 * Multiple Data Tables support
 	 * Allows to register additional Settings Data Tables if needed
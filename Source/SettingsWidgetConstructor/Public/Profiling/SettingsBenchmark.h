@@ -0,0 +1,112 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#if !UE_BUILD_SHIPPING
+
+#include "Data/SettingTag.h"
+//---
+#include "UObject/SoftObjectPath.h"
+
+class USettingsDataTable;
+class USettingsWidget;
+
+/**
+ * Describes what and how many times the settings benchmark measures.
+ * Can be parsed from the console arguments, see FSettingsBenchmark::ConsoleCommandName.
+ */
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsBenchmarkParams
+{
+	/** Amount of rows in each generated Settings Data Table, every amount is measured separately. */
+	TArray<int32> RowsNums = {10, 100, 1000, 5000};
+
+	/** How many settings are updated by each leading checkbox in its 'Settings To Update', defines the propagation fan-out. */
+	int32 FanOut = 4;
+
+	/** How many times each case is repeated, the average, min and max are reported. */
+	int32 Iterations = 5;
+
+	/** If false, only data cases are measured, so no Settings Widget is created. */
+	bool bMeasureWidget = true;
+
+	/** If set, the engine is requested to exit once the report is written, is useful for headless runs. */
+	bool bQuitOnFinish = false;
+
+	/** The Settings Widget class to create, if not set, new instance of the class of already created Settings Widget is measured.
+	 * The Settings Widget shown in game is never measured directly, so it stays untouched by the benchmark. */
+	FSoftClassPath WidgetClass;
+
+	/** Parses params from console arguments like: Rows=10,100 FanOut=4 Iterations=5 -NoWidget -Quit WidgetClass=/Game/... */
+	static FSettingsBenchmarkParams FromString(const FString& Args);
+};
+
+/**
+ * Measured timings of one benchmark case.
+ */
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsBenchmarkResult
+{
+	/** The name of measured case, e.g: 'ConstructSettings'. */
+	FString CaseName;
+
+	/** Amount of rows in the measured table. */
+	int32 RowsNum = 0;
+
+	/** The propagation fan-out of the measured table. */
+	int32 FanOut = 0;
+
+	/** How many times the case was repeated. */
+	int32 Iterations = 0;
+
+	/** Average, min and max time of one iteration in milliseconds. */
+	double AvgMs = 0.0;
+	double MinMs = 0.0;
+	double MaxMs = 0.0;
+};
+
+/**
+ * Measures the settings pipeline on generated Settings Data Tables of different sizes:
+ * rows generation, table caching, lookups, settings construction, updating, propagation, saving and Slate painting per invalidation mode.
+ * Results are written as CSV and JSON into 'Saved/SettingsWidgetConstructor/Benchmark', so runs can be compared over time.
+ * Is run by the console command, also in headless mode:
+ * UnrealEditor.exe Project.uproject -game -nullrhi -nosound -ExecCmds="SettingsWidgetConstructor.Benchmark -Quit"
+ */
+class SETTINGSWIDGETCONSTRUCTOR_API FSettingsBenchmark
+{
+public:
+	/** The name of console command to run the benchmark. */
+	static const TCHAR* ConsoleCommandName;
+
+	/** Runs all benchmark cases with given params, returns false if nothing was measured. */
+	static bool Run(UWorld* World, const FSettingsBenchmarkParams& Params, TArray<FSettingsBenchmarkResult>& OutResults);
+
+	/** Creates transient Settings Data Table with specified amount of rows, where archetypes are alternated.
+	 * Rows are grouped by leading checkboxes, each of them updates next FanOut settings. */
+	static USettingsDataTable* GenerateDataTable(int32 RowsNum, int32 FanOut);
+
+	/** Writes CSV and JSON reports, returns the path of written CSV file or empty string on fail. */
+	static FString WriteReport(const TArray<FSettingsBenchmarkResult>& Results);
+
+	/** Returns the setting tag of generated row by its index, is invalid if tags were not registered. */
+	static FSettingTag GetBenchmarkTag(int32 RowIndex);
+
+	/** Is called by the console command to run the benchmark with parsed params and write the report. */
+	static void OnConsoleCommand(const TArray<FString>& Args, UWorld* World);
+
+protected:
+	/** Registers generated setting tags for specified amount of rows as transient native tags, so nothing is written to tag configs. */
+	static bool RegisterBenchmarkTags(int32 RowsNum);
+
+	/** Removes all generated setting tags from the gameplay tags manager once the benchmark is finished. */
+	static void UnregisterBenchmarkTags();
+
+	/** Measures cases that don't require any widget. */
+	static void RunDataCases(const USettingsDataTable& DataTable, int32 RowsNum, const FSettingsBenchmarkParams& Params, TArray<FSettingsBenchmarkResult>& OutResults);
+
+	/** Measures cases on specified Settings Widget, its Slate resources are released at the end. */
+	static void RunWidgetCases(USettingsWidget& SettingsWidget, const USettingsDataTable& DataTable, int32 RowsNum, const FSettingsBenchmarkParams& Params, TArray<FSettingsBenchmarkResult>& OutResults);
+
+	/** Creates new Settings Widget to measure, is never the Settings Widget shown in game. */
+	static USettingsWidget* CreateSettingsWidget(UWorld& World, const FSettingsBenchmarkParams& Params);
+};
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,92 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "UObject/Object.h"
+//---
+#include "SettingsBenchmarkOwner.generated.h"
+
+/**
+ * Owner of all generated settings that are measured by the settings benchmark.
+ * Its static 'Owner' function returns the class default object, where all getters and setters just store the value, so measurements contain only the cost of the plugin itself.
+ * Values are saved into own 'SettingsBenchmark' config, so saving is measured without touching configs of real owners.
+ * @see FSettingsBenchmark
+ */
+UCLASS(Transient, Config = SettingsBenchmark, NotBlueprintable, HideDropdown)
+class SETTINGSWIDGETCONSTRUCTOR_API USettingsBenchmarkOwner : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the owner of all benchmark settings, is picked as 'Owner' function by generated rows. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Benchmark", meta = (WorldContext = "WorldContext"))
+	static UObject* GetBenchmarkOwner(const UObject* WorldContext);
+
+	/*********************************************************************************************
+	 * Getters and setters of generated settings
+	 ********************************************************************************************* */
+public:
+	UFUNCTION()
+	void OnButtonPressed() {}
+
+	UFUNCTION()
+	bool GetCheckbox() const { return bCheckboxInternal; }
+
+	UFUNCTION()
+	void SetCheckbox(bool InValue) { bCheckboxInternal = InValue; }
+
+	UFUNCTION()
+	int32 GetComboboxIndex() const { return ComboboxIndexInternal; }
+
+	UFUNCTION()
+	void SetComboboxIndex(int32 InValue) { ComboboxIndexInternal = InValue; }
+
+	UFUNCTION()
+	void GetComboboxMembers(TArray<FText>& OutMembers) const { OutMembers = ComboboxMembersInternal; }
+
+	UFUNCTION()
+	void SetComboboxMembers(const TArray<FText>& InMembers) { ComboboxMembersInternal = InMembers; }
+
+	UFUNCTION()
+	double GetSlider() const { return SliderInternal; }
+
+	UFUNCTION()
+	void SetSlider(double InValue) { SliderInternal = InValue; }
+
+	UFUNCTION()
+	void GetTextLine(FText& OutText) const { OutText = TextLineInternal; }
+
+	UFUNCTION()
+	void SetTextLine(FText InText) { TextLineInternal = InText; }
+
+	UFUNCTION()
+	FName GetUserInput() const { return UserInputInternal; }
+
+	UFUNCTION()
+	void SetUserInput(FName InValue) { UserInputInternal = InValue; }
+
+protected:
+	/** The last value set to any generated checkbox. */
+	UPROPERTY(Config)
+	bool bCheckboxInternal = false;
+
+	/** The last index set to any generated combobox. */
+	UPROPERTY(Config)
+	int32 ComboboxIndexInternal = 0;
+
+	/** The last members set to any generated combobox. */
+	UPROPERTY(Config)
+	TArray<FText> ComboboxMembersInternal;
+
+	/** The last value set to any generated slider. */
+	UPROPERTY(Config)
+	double SliderInternal = 0.5;
+
+	/** The last text set to any generated text line. */
+	UPROPERTY(Config)
+	FText TextLineInternal;
+
+	/** The last value set to any generated user input. */
+	UPROPERTY(Config)
+	FName UserInputInternal = NAME_None;
+};
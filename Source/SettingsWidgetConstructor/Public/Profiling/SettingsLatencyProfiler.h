@@ -0,0 +1,107 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Data/SettingTag.h"
+//---
+#include "HAL/PlatformTime.h"
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Kinds of game-side calls bound to settings that are recorded by the latency profiler.
+ */
+enum class ESettingCallKind : uint8
+{
+	Getter,
+	Setter,
+	GetMembers,
+	Owner,
+	MAX
+};
+
+/**
+ * Accumulated latency of one kind of game-side calls of one setting.
+ */
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingCallStats
+{
+	/** The tag name of the setting whose function was called. */
+	FName Tag = NAME_None;
+
+	/** The kind of called function. */
+	ESettingCallKind Kind = ESettingCallKind::Getter;
+
+	/** How many times the function was called. */
+	int32 CallsNum = 0;
+
+	/** The summary and the longest wall time of calls in milliseconds. */
+	double TotalMs = 0.0;
+	double MaxMs = 0.0;
+
+	/** Returns the average wall time of one call in milliseconds. */
+	FORCEINLINE double GetAvgMs() const { return CallsNum > 0 ? TotalMs / CallsNum : 0.0; }
+};
+
+/**
+ * Opt-in profiler of game-side getters, setters, combobox members and owner functions bound to settings.
+ * Helps to find the slow getter that makes the whole menu laggy, since all getters are called on opening the settings.
+ * Is enabled by 'SettingsWidgetConstructor.Profiler.Enable 1', then:
+ * 'SettingsWidgetConstructor.Profiler.Top [N]' prints the slowest settings to the log,
+ * 'SettingsWidgetConstructor.Profiler.Dump' writes all records to 'Saved/SettingsWidgetConstructor/Profiler' as CSV,
+ * 'SettingsWidgetConstructor.Profiler.Overlay N' draws N slowest settings over the Settings Widget,
+ * 'SettingsWidgetConstructor.Profiler.Reset' clears all records.
+ * Records are expected to be done on the game thread only, the whole profiler with its console variables is compiled out in shipping builds.
+ */
+class SETTINGSWIDGETCONSTRUCTOR_API FSettingsLatencyProfiler
+{
+public:
+	/** Returns true if calls have to be recorded. */
+	static bool IsEnabled();
+
+	/** Returns how many slowest settings have to be drawn over the Settings Widget, 0 if overlay is disabled. */
+	static int32 GetOverlayRowsNum();
+
+	/** Accumulates the wall time of one call of specified setting. */
+	static void Record(FName Tag, ESettingCallKind Kind, double ElapsedSeconds);
+
+	/** Returns specified amount of records with the longest total time, sorted from the slowest. */
+	static void GetTopOffenders(int32 Num, TArray<FSettingCallStats>& OutStats);
+
+	/** Writes all records as CSV, returns the path of written file or empty string on fail. */
+	static FString DumpToCsv();
+
+	/** Clears all records. */
+	static void Reset();
+
+	/** Returns the readable name of specified call kind. */
+	static const TCHAR* GetCallKindName(ESettingCallKind Kind);
+};
+
+/**
+ * Records the wall time of the game-side call within its scope if the profiler is enabled.
+ * Use SWC_SCOPE_SETTING_CALL instead of creating it directly.
+ */
+struct FSettingCallScope
+{
+	FSettingCallScope(const FSettingTag& InTag, ESettingCallKind InKind)
+		: StartTime(FSettingsLatencyProfiler::IsEnabled() ? FPlatformTime::Seconds() : 0.0)
+		, Tag(InTag.GetTagName())
+		, Kind(InKind) {}
+
+	~FSettingCallScope()
+	{
+		if (StartTime > 0.0)
+		{
+			FSettingsLatencyProfiler::Record(Tag, Kind, FPlatformTime::Seconds() - StartTime);
+		}
+	}
+
+private:
+	double StartTime = 0.0;
+	FName Tag = NAME_None;
+	ESettingCallKind Kind = ESettingCallKind::Getter;
+};
+
+#define SWC_SCOPE_SETTING_CALL(Tag, Kind) const FSettingCallScope ANONYMOUS_VARIABLE(SettingCallScope)(Tag, ESettingCallKind::Kind)
+#else
+#define SWC_SCOPE_SETTING_CALL(Tag, Kind)
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,82 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#if !UE_BUILD_SHIPPING
+
+#include "CoreMinimal.h"
+
+class USettingsWidget;
+
+/**
+ * Amount and bytes of one kind of settings data.
+ */
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsMemEntry
+{
+	/** How many elements are counted. */
+	int32 Num = 0;
+
+	/** Summary bytes of all counted elements, including their heap allocations. */
+	SIZE_T Bytes = 0;
+
+	/** Adds one element of specified size. */
+	FORCEINLINE void Add(SIZE_T InBytes) { ++Num; Bytes += InBytes; }
+};
+
+/**
+ * Memory accounting of settings rows and widgets created by the Settings Widget.
+ * Is printed by 'SettingsWidgetConstructor.MemReport' console command, also can be gathered and checked by automation tests.
+ * Bytes are estimated by struct sizes and allocated sizes of containers and texts, widgets are counted by their class size without slate resources.
+ * Every byte is counted once: inline data is counted by its container or by the class size of its widget, while other entries count only heap bytes.
+ */
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsMemReport
+{
+	/** Heap bytes of rows cached by the Settings Widget, grouped by their archetype, e.g: 'Checkbox'.
+	 * Rows themselves are stored inline in the rows map, so their struct size is counted by RowsContainerBytes.
+	 * @see USettingsWidget::SettingsEngineInternal */
+	TMap<FName, FSettingsMemEntry> RowsByArchetype;
+
+	/** Amount of rows in the rows map and bytes allocated by the map itself, where all rows are stored inline. */
+	int32 RowsContainerNum = 0;
+	SIZE_T RowsContainerBytes = 0;
+
+	/** Amount of rows bound by the row store and bytes allocated by its per-player arrays, the index shared by all players is not included.
+	 * @see FSettingsRowStore */
+	int32 RowStoreNum = 0;
+	SIZE_T RowStoreBytes = 0;
+
+	/** Bytes allocated by the row index shared by all players.
+	 * @see FSettingsRowIndex */
+	SIZE_T RowIndexBytes = 0;
+
+	/** Unique lists of owner function names, each list shared by the same owner class is counted once, are not included in RowsByArchetype.
+	 * @see FSettingsPrimary::OwnerFunctionList */
+	FSettingsMemEntry OwnerFunctionLists;
+
+	/** Heap bytes of the primary data copied by each setting sub-widget, its struct size is counted by SubWidgets. */
+	FSettingsMemEntry SubWidgetPrimaryCopies;
+
+	/** Struct bytes of the archetype data copied by each setting sub-widget, grouped by their archetype.
+	 * Are already counted by the class size of SubWidgets, so they are shown only for reference and are not included in the total. */
+	TMap<FName, FSettingsMemEntry> SubWidgetArchetypeCopies;
+
+	/** All created setting sub-widgets, columns are included. */
+	FSettingsMemEntry SubWidgets;
+
+	/** All created comboitem widgets of all comboboxes. */
+	FSettingsMemEntry ComboitemWidgets;
+
+	/** All created tooltip widgets. */
+	FSettingsMemEntry TooltipWidgets;
+
+	/** Collects the report of specified Settings Widget. */
+	static FSettingsMemReport Gather(const USettingsWidget& SettingsWidget);
+
+	/** Returns summary bytes of the whole report. */
+	SIZE_T GetTotalBytes() const;
+
+	/** Prints the report to specified output device, e.g: to the log. */
+	void Print(FOutputDevice& Ar) const;
+};
+
+#endif // !UE_BUILD_SHIPPING
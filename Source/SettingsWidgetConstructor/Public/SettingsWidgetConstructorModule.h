@@ -4,6 +4,8 @@
 
 #include "Modules/ModuleInterface.h"
 
+SETTINGSWIDGETCONSTRUCTOR_API DECLARE_LOG_CATEGORY_EXTERN(LogSettingsWidgetConstructor, Log, All);
+
 class SETTINGSWIDGETCONSTRUCTOR_API FSettingsWidgetConstructorModule : public IModuleInterface
 {
 public:
@@ -0,0 +1,89 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Subsystems/GameInstanceSubsystem.h"
+//---
+#include "UObject/ObjectKey.h"
+//---
+#include "SettingsCatalogSubsystem.generated.h"
+
+struct FSettingsSharedCatalog;
+class FSettingsEngine;
+class USettingsDataTable;
+
+/**
+ * Holds data that is the same for Settings Widgets of all local players, so split-screen menus don't compute it again:
+ * the immutable catalog of merged rows with their shared index, and resolved functions of owner classes.
+ * Each Settings Widget binds own copy of rows to the shared index, since their bound delegates, values and sub-widgets are per player.
+ * The catalog is merged again once other tables are requested or any of its tables is changed, e.g: edited in PIE.
+ * Also holds the headless Settings Engine to get, set and save settings without any Settings Widget, e.g: on dedicated server.
+ * @see USettingsWidgetSubsystem for per-player Settings Widgets.
+ */
+UCLASS()
+class SETTINGSWIDGETCONSTRUCTOR_API USettingsCatalogSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns this subsystem of the game instance of specified object's world. */
+	static USettingsCatalogSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Collects names of all functions of specified owner class, is used when there is no game instance, e.g: in editor preview. */
+	static TSharedRef<const TSet<FName>> MakeOwnerFunctions(const UClass& OwnerClass);
+
+	/** Returns the catalog merged from specified tables, is built only if there is no catalog of the same unchanged tables yet. */
+	TSharedRef<const FSettingsSharedCatalog> GetSharedCatalog(const TSet<const USettingsDataTable*>& DataTables);
+
+	/** Returns names of all functions of specified owner class, are shared by all rows and players with the same owner class. */
+	TSharedRef<const TSet<FName>> GetOwnerFunctions(const UClass& OwnerClass);
+
+	/** Collects functions of all specified owner classes that are not cached yet in parallel, so rows are bound on the game thread without walking classes. */
+	void CacheOwnerFunctions(TConstArrayView<const UClass*> OwnerClasses);
+
+	/** Returns amount of rows in the shared catalog, or 0 if it's not built yet. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	int32 GetSharedRowsNum() const;
+
+	/** Releases the shared catalog and owner functions, so they are built again on next request.
+	 * Widgets that already use the released catalog keep it until they are reconstructed. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void InvalidateSharedCatalog();
+
+	/** Returns the headless Settings Engine bound to all Settings Data Tables, is initialized on first request. */
+	FSettingsEngine& GetSettingsEngine();
+
+	/** Returns the current value of specified setting in a string format without any Settings Widget.
+	 * @param TagName The full tag name of the setting, e.g: 'Settings.Checkbox.VSync'. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	FString GetSettingValueHeadless(FName TagName);
+
+	/** Sets the value of specified setting in a string format without any Settings Widget.
+	 * @param TagName The full tag name of the setting, e.g: 'Settings.Checkbox.VSync'.
+	 * @return true if the value is changed. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	bool SetSettingValueHeadless(FName TagName, const FString& Value);
+
+	/** Applies and saves all settings set without any Settings Widget. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void SaveSettingsHeadless();
+
+protected:
+	/** The catalog shared by Settings Widgets of all local players. */
+	TSharedPtr<const FSettingsSharedCatalog> SharedCatalogInternal = nullptr;
+
+	/** Names of all functions by each owner class. */
+	TMap<FObjectKey, TSharedRef<const TSet<FName>>> OwnerFunctionsInternal;
+
+	/** The headless Settings Engine, is created on first request. */
+	TSharedPtr<FSettingsEngine> SettingsEngineInternal = nullptr;
+
+	/** Is overridden to track changes of the Settings Data Registry. */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Is overridden to release all shared data. */
+	virtual void Deinitialize() override;
+
+	/** Is called when tables are added to or removed from the Settings Data Registry, so the headless engine takes rows of new tables on next request. */
+	void OnSettingsDataRegistryChanged(class UDataRegistry* SettingsDataRegistry);
+};
@@ -0,0 +1,38 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Subsystems/LocalPlayerSubsystem.h"
+//---
+#include "SettingsWidgetSubsystem.generated.h"
+
+class USettingsWidget;
+
+/**
+ * Keeps the Settings Widget of each local player, so it can be found without iterating all widgets.
+ * The Settings Widget registers itself on construct and unregisters on destruct.
+ */
+UCLASS()
+class SETTINGSWIDGETCONSTRUCTOR_API USettingsWidgetSubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns this subsystem of the local player that owns specified object, or of the first local player in its world. */
+	static USettingsWidgetSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Returns the Settings Widget of this local player or null if is not constructed. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	USettingsWidget* GetSettingsWidget() const { return SettingsWidgetInternal.Get(); }
+
+	/** Registers specified widget as the Settings Widget of this local player. */
+	void RegisterSettingsWidget(USettingsWidget* SettingsWidget);
+
+	/** Unregisters specified widget if it is the registered Settings Widget of this local player. */
+	void UnregisterSettingsWidget(const USettingsWidget* SettingsWidget);
+
+protected:
+	/** The registered Settings Widget of this local player. */
+	UPROPERTY(VisibleInstanceOnly, Transient, Category = "Settings Widget Constructor", meta = (DisplayName = "Settings Widget"))
+	TWeakObjectPtr<USettingsWidget> SettingsWidgetInternal = nullptr;
+};
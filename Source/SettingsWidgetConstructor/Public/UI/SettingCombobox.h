@@ -33,7 +33,10 @@ public:
 
 	/** Returns the combobox setting data. */
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
-	const FORCEINLINE FSettingsCombobox& GetComboboxData() const { return ComboboxDataInternal; }
+	const FORCEINLINE FSettingsCombobox& GetComboboxData() const { return GetSettingRow().Combobox; }
+
+	/** Returns all created comboitem widgets. */
+	const FORCEINLINE TArray<TObjectPtr<class USettingComboitem>>& GetComboitemWidgets() const { return ComboitemWidgets; }
 
 	/** Set the new combobox setting data for this widget. */
 	UFUNCTION(BlueprintCallable, Category = "SettingSubWidget", meta = (AutoCreateRefTerm = "InComboboxData"))
@@ -43,6 +46,9 @@ public:
 	 * @warning is not blueprintable, don't call it directly, but use Setter function from the Settings Widget. */
 	void SetComboboxIndex(int32 InValue);
 
+	/** Is overridden to update texts of comboitems in place, options are refilled only if IDs of members are changed. */
+	virtual void RefreshTexts() override;
+
 protected:
 	/** Blueprint event called when the the subwidget value is changed. */
 	UFUNCTION(BlueprintImplementableEvent, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "On Set Combobox Index"))
@@ -63,20 +69,20 @@ protected:
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Is Combobox Opened"))
 	bool bIsComboboxOpenedInternal = false;
 
-	/** The combobox setting data. */
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Combobox Data"))
-	FSettingsCombobox ComboboxDataInternal;
-
 	/** All created comboitem widgets. */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Comboitem Widgets"))
 	TArray<TObjectPtr<class USettingComboitem>> ComboitemWidgets;
 
+	/** Created comboitem widgets by their Text IDs, so the engine gets them without resolving IDs of all items again.
+	 * Widgets are kept alive by ComboitemWidgets. */
+	TMap<FString/*TextId*/, TWeakObjectPtr<class USettingComboitem>> ComboitemsByTextIdInternal;
+
 	/*********************************************************************************************
 	 * Events and overrides
 	 ********************************************************************************************* */
 public:
 	/** Is overridden to return the combobox data of this widget. */
-	virtual const FSettingsDataBase* GetSettingData() const override { return &ComboboxDataInternal; }
+	virtual const FSettingsDataBase* GetSettingData() const override { return &GetComboboxData(); }
 
 protected:
 	/** Is the earliest point where the BindWidget properties are constructed. */
@@ -0,0 +1,126 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "UI/SettingSubWidget.h"
+//---
+#include "Data/SettingsRowStore.h"
+//---
+#include "SettingSlateRow.generated.h"
+
+class SBox;
+class SButton;
+class SCheckBox;
+class SEditableTextBox;
+class SSlider;
+class STextBlock;
+template <typename T>
+class SComboBox;
+
+/**
+ * Lightweight sub-widget of any setting type that is built directly from native Slate widgets styled by the theme data.
+ * Unlike Blueprint sub-widgets, it has no widget tree, so there is no Blueprint construction and no BindWidget properties.
+ * Is chosen by USettingsDataAsset::SlateRowTypesInternal per setting type, while other types keep their Blueprint sub-widgets.
+ */
+UCLASS(NotBlueprintable)
+class SETTINGSWIDGETCONSTRUCTOR_API USettingSlateRow : public USettingSubWidget
+{
+	GENERATED_BODY()
+
+public:
+	typedef SComboBox<TSharedPtr<FText>> SComboboxText;
+
+	/** Returns true if specified setting type is chosen in the Settings Data Asset to be shown by native Slate rows. */
+	static bool IsSlateRowArchetype(ESettingArchetype Archetype);
+
+	/** Returns the setting type of this row. */
+	FORCEINLINE ESettingArchetype GetArchetype() const { return ArchetypeInternal; }
+
+	/** Pushes the current value of the setting from its row into Slate widgets, while the setter is not called.
+	 * @warning don't call it directly, but use Setter function from the Settings Widget. */
+	void RefreshValue();
+
+	/*********************************************************************************************
+	 * Data
+	 ********************************************************************************************* */
+protected:
+	/** The setting type of this row, is taken from its row on adding the setting. */
+	ESettingArchetype ArchetypeInternal = ESettingArchetype::None;
+
+	/** The box that limits the height of this row. */
+	TSharedPtr<SBox> SlateSizeBoxInternal = nullptr;
+
+	/** The text that shows the caption of this setting. */
+	TSharedPtr<STextBlock> SlateCaptionInternal = nullptr;
+
+	/** The slate button, is set only for buttons. */
+	TSharedPtr<SButton> SlateButtonInternal = nullptr;
+
+	/** The slate checkbox, is set only for checkboxes. */
+	TSharedPtr<SCheckBox> SlateCheckboxInternal = nullptr;
+
+	/** The slate slider, is set only for sliders. */
+	TSharedPtr<SSlider> SlateSliderInternal = nullptr;
+
+	/** The slate combobox, is set only for comboboxes. */
+	TSharedPtr<SComboboxText> SlateComboboxInternal = nullptr;
+
+	/** The text that shows the chosen member of the combobox. */
+	TSharedPtr<STextBlock> SlateComboboxTextInternal = nullptr;
+
+	/** Members of the combobox, are shared with its options list. */
+	TArray<TSharedPtr<FText>> ComboboxOptionsInternal;
+
+	/** The slate text box, is set only for user inputs. */
+	TSharedPtr<SEditableTextBox> SlateEditableTextBoxInternal = nullptr;
+
+	/*********************************************************************************************
+	 * Events and overrides
+	 ********************************************************************************************* */
+public:
+	/** Is overridden to return the chosen data of the setting row. */
+	virtual const FSettingsDataBase* GetSettingData() const override;
+
+	/** Is overridden to take the setting type before the row is built. */
+	virtual void OnAddSetting(const FSettingsPicker& Setting) override;
+
+	/** Is overridden to set the caption and combobox options again, since they are the same texts that have to be measured in the new culture. */
+	virtual void RefreshTexts() override;
+
+protected:
+	/** Is overridden to build the whole row from native Slate widgets instead of the widget tree. */
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+	/** Releases all Slate widgets of this row. */
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+	/** Returns the Slate widget that shows the value of specified setting, or null widget if the type has no value. */
+	TSharedRef<SWidget> BuildValueWidget(const FSettingsPicker& Setting);
+
+	/** Refills combobox options if its members are changed, returns true if options were refilled. */
+	bool RefreshComboboxOptions(const TArray<FText>& Members);
+
+	/** Called when the button is pressed. */
+	FReply OnButtonClicked();
+
+	/** Called when the checked state has changed. */
+	void OnCheckStateChanged(ECheckBoxState NewState);
+
+	/** Called when the value is changed by slider. */
+	void OnSliderValueChanged(float NewValue);
+
+	/** Invoked when the mouse is released and a capture ends. */
+	void OnSliderMouseCaptureEnd();
+
+	/** Called when a new member is selected in the combobox. */
+	void OnComboboxSelectionChanged(TSharedPtr<FText> SelectedItem, ESelectInfo::Type SelectionType);
+
+	/** Called when the combobox is opened. */
+	void OnComboboxOpening();
+
+	/** Returns the widget of specified member in the opened combobox. */
+	TSharedRef<SWidget> OnGenerateComboitem(TSharedPtr<FText> InItem) const;
+
+	/** Called whenever the text is changed interactively by the user. */
+	void OnUserInputChanged(const FText& Text);
+};
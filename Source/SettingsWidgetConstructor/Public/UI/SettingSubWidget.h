@@ -4,6 +4,7 @@
 
 #include "Blueprint/UserWidget.h"
 //---
+#include "Data/SettingHandle.h"
 #include "Data/SettingsRow.h"
 //---
 #include "SettingSubWidget.generated.h"
@@ -43,13 +44,21 @@ public:
 
 	/** Returns the setting tag of this widget. */
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
-	const FORCEINLINE FSettingTag& GetSettingTag() const { return PrimaryDataInternal.Tag; }
+	const FORCEINLINE FSettingTag& GetSettingTag() const { return SettingTagInternal; }
 
-	/** Returns the setting primary row of this widget. */
+	/** Returns the handle of this widget's row in the Settings Widget, is resolved once the setting primary row is set. */
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
-	const FORCEINLINE FSettingsPrimary& GetSettingPrimaryRow() const { return PrimaryDataInternal; }
+	const FORCEINLINE FSettingHandle& GetSettingHandle() const { return SettingHandleInternal; }
 
-	/** Set the new setting tag for this widget. */
+	/** Returns the row of this widget from the row store of the Settings Widget by the cached handle, is empty if the row is not found.
+	 * @see USettingsWidget::GetSettingRow */
+	const FSettingsPicker& GetSettingRow() const;
+
+	/** Returns the setting primary row of this widget, is taken from the row store of the Settings Widget. */
+	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
+	const FSettingsPrimary& GetSettingPrimaryRow() const;
+
+	/** Set the new setting tag for this widget and resolves the handle of its row. */
 	UFUNCTION(BlueprintCallable, Category = "SettingSubWidget", meta = (AutoCreateRefTerm = "InSettingPrimaryRow"))
 	void SetSettingPrimaryRow(const FSettingsPrimary& InSettingPrimaryRow);
 
@@ -66,7 +75,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
 	FORCEINLINE UPanelSlot* GetParentSlot() const { return ParentSlotInternal; }
 
-	/** Adds given widget as tooltip to this setting. */
+	/** Adds the tooltip to this setting.
+	 * The tooltip widget is shared by all settings and is populated only on hover.
+	 * @see USettingsWidget::GetSharedTooltip */
 	UFUNCTION(BlueprintCallable, Category = "SettingSubWidget")
 	void AddTooltipWidget();
 
@@ -83,6 +94,10 @@ public:
 	void BPOnAddSetting();
 	virtual void OnAddSetting(const FSettingsPicker& Setting);
 
+	/** Base method that updates texts shown by this widget in place, is called after the culture is changed.
+	 * @see USettingsWidget::OnCultureChanged */
+	virtual void RefreshTexts();
+
 protected:
 	/** Sets the parent widget element in hierarchy of this subwidget.
 	 * @return The slot where this widget was added, or null if the add failed. */
@@ -93,6 +108,14 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "SettingSubWidget|Theme")
 	void ApplyTheme();
 
+	/** Is called on hover to return the shared tooltip widget filled with the tooltip text of this setting. */
+	UFUNCTION()
+	UWidget* OnGetSharedTooltip();
+
+	/** Returns the mutable row of this widget from the row store of the Settings Widget, is used to set the setting data.
+	 * @warning don't hold the pointer, it's invalidated once any row is added or removed. */
+	FSettingsPicker* GetSettingRowMutable() const;
+
 	/*********************************************************************************************
 	 * Data
 	 ********************************************************************************************* */
@@ -105,7 +128,19 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, BindWidget))
 	TObjectPtr<class UTextBlock> CaptionWidget = nullptr;
 
-	/** The setting primary row of this widget. */
+	/** The tag of this widget, its row in the Settings Widget is referenced by the handle, so the row data is not copied into each widget. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Setting Tag"))
+	FSettingTag SettingTagInternal = FSettingTag::EmptySettingTag;
+
+	/** The handle of this widget's row in the Settings Widget, is resolved once by the tag, so the row is not searched on every access.
+	 * Sub-widgets are recreated on every rebuild of settings, so the handle stays valid for the whole life of this widget.
+	 * @see USettingSubWidget::GetSettingRow */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Setting Handle"))
+	FSettingHandle SettingHandleInternal = FSettingHandle::EmptyHandle;
+
+	/** The blueprint view of the setting primary row, is filled once on adding the setting without the owner functions list.
+	 * Native code reads the row from the Settings Widget instead.
+	 * @see USettingSubWidget::GetSettingPrimaryRow */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Primary Data"))
 	FSettingsPrimary PrimaryDataInternal = FSettingsPrimary::EmptyPrimary;
 
@@ -136,7 +171,7 @@ public:
 
 	/** Returns the button setting data. */
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
-	const FORCEINLINE FSettingsButton& GetButtonData() const { return ButtonDataInternal; }
+	const FSettingsButton& GetButtonData() const;
 
 	/** Set the new button setting data for this widget. */
 	UFUNCTION(BlueprintCallable, Category = "SettingSubWidget", meta = (AutoCreateRefTerm = "InButtonData"))
@@ -153,7 +188,8 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, BindWidget))
 	TObjectPtr<class UButton> ButtonWidget = nullptr;
 
-	/** The button setting data. */
+	/** The blueprint view of the button setting data, native code reads it from the Settings Widget instead.
+	 * @see USettingButton::GetButtonData */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Button Data"))
 	FSettingsButton ButtonDataInternal;
 
@@ -162,7 +198,7 @@ protected:
 	 ********************************************************************************************* */
 public:
 	/** Is overridden to return the button data of this widget. */
-	virtual const FSettingsDataBase* GetSettingData() const override { return &ButtonDataInternal; }
+	virtual const FSettingsDataBase* GetSettingData() const override { return &GetButtonData(); }
 
 protected:
 	/** Called after the underlying slate widget is constructed.
@@ -196,7 +232,7 @@ public:
 
 	/** Returns the checkbox setting data. */
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
-	const FORCEINLINE FSettingsCheckbox& GetCheckboxData() const { return CheckboxDataInternal; }
+	const FORCEINLINE FSettingsCheckbox& GetCheckboxData() const { return GetSettingRow().Checkbox; }
 
 	/** Set the new checkbox setting data for this widget. */
 	UFUNCTION(BlueprintCallable, Category = "SettingSubWidget", meta = (AutoCreateRefTerm = "InCheckboxData"))
@@ -222,16 +258,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, BindWidget))
 	TObjectPtr<class UCheckBox> CheckboxWidget = nullptr;
 
-	/** The checkbox setting data. */
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Checkbox Data"))
-	FSettingsCheckbox CheckboxDataInternal;
-
 	/*********************************************************************************************
 	 * Events and overrides
 	 ********************************************************************************************* */
 public:
 	/** Is overridden to return the checkbox data of this widget. */
-	virtual const FSettingsDataBase* GetSettingData() const override { return &CheckboxDataInternal; }
+	virtual const FSettingsDataBase* GetSettingData() const override { return &GetCheckboxData(); }
 
 protected:
 	/** Called after the underlying slate widget is constructed.
@@ -265,7 +297,7 @@ public:
 
 	/** Returns the slider setting data. */
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
-	const FORCEINLINE FSettingsSlider& GetSliderData() const { return SliderDataInternal; }
+	const FORCEINLINE FSettingsSlider& GetSliderData() const { return GetSettingRow().Slider; }
 
 	/** Set the new slider setting data for this widget. */
 	UFUNCTION(BlueprintCallable, Category = "SettingSubWidget", meta = (AutoCreateRefTerm = "InSliderData"))
@@ -291,16 +323,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, BindWidget))
 	TObjectPtr<class USlider> SliderWidget = nullptr;
 
-	/** The slider setting data. */
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Slider Data"))
-	FSettingsSlider SliderDataInternal;
-
 	/*********************************************************************************************
 	 * Events and overrides
 	 ********************************************************************************************* */
 public:
 	/** Is overridden to return the slider data of this widget. */
-	virtual const FSettingsDataBase* GetSettingData() const override { return &SliderDataInternal; }
+	virtual const FSettingsDataBase* GetSettingData() const override { return &GetSliderData(); }
 
 protected:
 	/** Called after the underlying slate widget is constructed.
@@ -331,7 +359,7 @@ class SETTINGSWIDGETCONSTRUCTOR_API USettingTextLine : public USettingSubWidget
 public:
 	/** Returns the Text Line setting data. */
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
-	const FORCEINLINE FSettingsTextLine& GetTextLineData() const { return TextLineDataInternal; }
+	const FSettingsTextLine& GetTextLineData() const;
 
 	/** Set the new Text Line setting data for this widget. */
 	UFUNCTION(BlueprintCallable, Category = "SettingSubWidget", meta = (AutoCreateRefTerm = "InTextLineData"))
@@ -341,7 +369,8 @@ public:
 	 * Data
 	 ********************************************************************************************* */
 protected:
-	/** The text line setting data. */
+	/** The blueprint view of the text line setting data, native code reads it from the Settings Widget instead.
+	 * @see USettingTextLine::GetTextLineData */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Text Line Data"))
 	FSettingsTextLine TextLineDataInternal;
 
@@ -350,7 +379,7 @@ protected:
 	 ********************************************************************************************* */
 public:
 	/** Is overridden to return the text line data of this widget. */
-	virtual const FSettingsDataBase* GetSettingData() const override { return &TextLineDataInternal; }
+	virtual const FSettingsDataBase* GetSettingData() const override { return &GetTextLineData(); }
 
 protected:
 	/** Is overridden to construct the text line. */
@@ -379,7 +408,7 @@ public:
 
 	/** Returns the user input setting data. */
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
-	const FORCEINLINE FSettingsUserInput& GetUserInputData() const { return UserInputDataInternal; }
+	const FORCEINLINE FSettingsUserInput& GetUserInputData() const { return GetSettingRow().UserInput; }
 
 	/** Set the new user input setting data for this widget. */
 	UFUNCTION(BlueprintCallable, Category = "SettingSubWidget", meta = (AutoCreateRefTerm = "InUserInputData"))
@@ -405,16 +434,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, BindWidget))
 	TObjectPtr<class UEditableTextBox> EditableTextBox = nullptr;
 
-	/** The user input setting data. */
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "User Input Data"))
-	FSettingsUserInput UserInputDataInternal;
-
 	/*********************************************************************************************
 	 * Events and overrides
 	 ********************************************************************************************* */
 public:
 	/** Is overridden to return the user input data of this widget. */
-	virtual const FSettingsDataBase* GetSettingData() const override { return &UserInputDataInternal; }
+	virtual const FSettingsDataBase* GetSettingData() const override { return &GetUserInputData(); }
 
 protected:
 	/** Called after the underlying slate widget is constructed.
@@ -441,26 +466,18 @@ class SETTINGSWIDGETCONSTRUCTOR_API USettingCustomWidget : public USettingSubWid
 public:
 	/** Returns the custom widget setting data. */
 	UFUNCTION(BlueprintPure, Category = "SettingSubWidget")
-	const FORCEINLINE FSettingsCustomWidget& GetCustomWidgetData() const { return CustomWidgetDataInternal; }
+	const FORCEINLINE FSettingsCustomWidget& GetCustomWidgetData() const { return GetSettingRow().CustomWidget; }
 
 	/** Set the new custom widget setting data for this widget. */
 	UFUNCTION(BlueprintCallable, Category = "SettingSubWidget", meta = (AutoCreateRefTerm = "InCustomWidgetData"))
 	void SetCustomWidgetData(const FSettingsCustomWidget& InCustomWidgetData);
 
-	/*********************************************************************************************
-	 * Data
-	 ********************************************************************************************* */
-protected:
-	/** The custom widget setting data. */
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "SettingSubWidget", meta = (BlueprintProtected, DisplayName = "Custom Widget Data"))
-	FSettingsCustomWidget CustomWidgetDataInternal;
-
 	/*********************************************************************************************
 	 * Events and overrides
 	 ********************************************************************************************* */
 public:
 	/** Is overridden to return the custom widget data of this widget. */
-	virtual const FSettingsDataBase* GetSettingData() const override { return &CustomWidgetDataInternal; }
+	virtual const FSettingsDataBase* GetSettingData() const override { return &GetCustomWidgetData(); }
 
 protected:
 	/** Is overridden to construct the custom widget. */
@@ -512,6 +529,10 @@ protected:
 	/** Called after the underlying slate widget is constructed.
 	 * May be called multiple times due to adding and removing from the hierarchy. */
 	virtual void NativeConstruct() override;
+
+	/** Is overridden to wrap the column into own invalidation root, so change of any setting repaints only its column.
+	 * @see USettingsWidget::GetInvalidationMode */
+	virtual TSharedRef<SWidget> RebuildWidget() override;
 };
 
 /**
@@ -4,7 +4,11 @@
 
 #include "Blueprint/UserWidget.h"
 //---
+#include "Data/SettingHandle.h"
+#include "Data/SettingsEngine.h"
 #include "Data/SettingsRow.h"
+#include "Data/SettingsRowStore.h"
+#include "Data/SettingsSnapshot.h"
 //---
 #include "SettingsWidget.generated.h"
 
@@ -17,6 +21,12 @@ class SETTINGSWIDGETCONSTRUCTOR_API USettingsWidget : public UUserWidget
 {
 	GENERATED_BODY()
 
+#if !UE_BUILD_SHIPPING
+	/** Is allowed to construct and rebuild settings directly to measure them. */
+	friend class FSettingsBenchmark;
+	friend struct FSettingsMemReport;
+#endif // !UE_BUILD_SHIPPING
+
 	/* ---------------------------------------------------
 	 *		Public properties
 	 * --------------------------------------------------- */
@@ -61,7 +71,7 @@ public:
 
 	/** Returns true when this widget is fully constructed and ready to be used. */
 	UFUNCTION(BlueprintPure, Category = "C++")
-	FORCEINLINE bool IsSettingsWidgetConstructed() const { return !SettingsTableRowsInternal.IsEmpty(); }
+	FORCEINLINE bool IsSettingsWidgetConstructed() const { return !SettingsEngineInternal.GetRows().IsEmpty(); }
 
 	/** Is called to player sound effect on any setting click. */
 	UFUNCTION(BlueprintImplementableEvent, Category = "Settings Widget Constructor")
@@ -69,7 +79,11 @@ public:
 
 	/** Returns the amount of settings rows. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
-	FORCEINLINE int32 GetSettingsTableRowsNum() const { return SettingsTableRowsInternal.Num(); }
+	FORCEINLINE int32 GetSettingsTableRowsNum() const { return SettingsEngineInternal.GetRows().Num(); }
+
+	/** Returns all settings rows by their tags. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE const TMap<FName, FSettingsPicker>& GetSettingsTableRows() const { return SettingsEngineInternal.GetRows(); }
 
 	/** Try to find the setting row.
 	* @param PotentialTagName The probable tag name by which the row will be found (for 'VSync' will find a row with 'Settings.Checkbox.VSync' tag).
@@ -82,6 +96,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingTag"))
 	const FSettingsPicker& GetSettingRow(const FSettingTag& SettingTag) const;
 
+	/** Returns the mutable row by specified tag, is used by sub-widgets to set their data in the single row store.
+	 * @warning don't hold the pointer, it's invalidated once any row is added or removed. */
+	FSettingsPicker* GetSettingRowMutable(const FSettingTag& SettingTag);
+
+	/** Returns the mutable row by specified handle or null if the handle is stale, is used by sub-widgets to set their data without the tag lookup.
+	 * @warning don't hold the pointer, it's invalidated once any row is added or removed. */
+	FSettingsPicker* GetSettingRowMutableByHandle(const FSettingHandle& SettingHandle);
+
+	/** Returns the dense index over all cached rows, is used by bulk passes over settings.
+	 * @see FSettingsEngine::RowStore */
+	FORCEINLINE const FSettingsRowStore& GetRowStore() const { return SettingsEngineInternal.GetRowStore(); }
+
 	/** Save all settings into their configs. */
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
 	void SaveSettings();
@@ -90,6 +116,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
 	void ApplySettings();
 
+	/** Requests to apply current settings on device at the end of this frame.
+	 * Multiple requests within the same frame are coalesced into a single apply.
+	 * @param bApplyResolution If true, the resolution will be reapplied as well, is taken into account only when 'Partial Apply Settings' is enabled in the Settings Data Asset. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void ApplySettingsDeferred(bool bApplyResolution = true);
+
 	/** Update specific settings on UI by tags.
 	 * Alternative, in code `UPDATE_SETTING_BY_FUNCTION(SettingsWidget, ThisClass, SetFullscreenMode)` can be used.
 	 * @param SettingsToUpdate Contains tags of settings that are needed to update.
@@ -104,6 +136,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
 	void UpdateAllSettings(bool bLoadFromConfig = false);
 
+	/** Update all settings on UI that depend on specified setting, are taken from its 'Settings To Update'. */
+	void UpdateDependentSettings(const FSettingTag& SettingTag);
+
+	/** Notifies that the value of specified setting was changed outside of the Settings Widget, e.g: by its owner.
+	 * If settings are shown, it's updated on UI right away, otherwise on next open when 'Dirty Only' refresh policy is set.
+	 * @see USettingsDataAsset::OpenRefreshPolicyInternal */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingTag"))
+	void NotifySettingChanged(const FSettingTag& SettingTag);
+
+	/** Notifies that all settings might be changed outside of the Settings Widget, e.g: their configs are reloaded, so all of them are refreshed on next open. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void NotifyAllSettingsChanged();
+
 	/** Returns the name of found tag by specified function. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingFunction"))
 	const FSettingTag& GetTagByFunction(const FSettingFunctionPicker& SettingFunction) const;
@@ -125,10 +170,24 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
 	float GetScrollBoxHeight() const;
 
-	/** Is blueprint-event called that returns the style brush by specified button state. */
+	/** Is blueprint-event called that returns the style brush by specified button state.
+	 * Returns the brush from the shared style cache, which is built once from the Settings Data Asset.
+	 * @see FSettingsStyleSet */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
 	static FSlateBrush GetButtonBrush(ESettingsButtonState State);
 
+	/** Returns the cached style brush by specified checkbox state. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	static FSlateBrush GetCheckboxBrush(ESettingsCheckboxState State);
+
+	/** Returns the cached style brush by specified slider state. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	static FSlateBrush GetSliderBrush(ESettingsSliderState State);
+
+	/** Returns the cached style brush of the combobox by specified state. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	static FSlateBrush GetComboboxBrush(ESettingsButtonState State);
+
 	/* ---------------------------------------------------
 	 *		Setters by setting types
 	 * --------------------------------------------------- */
@@ -175,6 +234,39 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "C++", meta = (AutoCreateRefTerm = "SettingPrimaryRow"))
 	void OnAnySettingSet(const FSettingsPrimary& SettingPrimaryRow);
 
+	/** Set values of many settings at once in a string format, as SetSettingValue does for each of them.
+	 * Dependent settings are updated once for the whole batch, click sounds are not played, and all changes are applied together.
+	 * @param SettingValues The value in a string format by the setting tag.
+	 * @param bSaveSettings If true, all settings are saved into their configs once the batch is set. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters")
+	void SetSettingsBatch(UPARAM(meta = (Categories = "Settings")) const TMap<FGameplayTag, FString>& SettingValues, bool bSaveSettings = false);
+
+	/** Returns true if settings are currently set by the batch, so dependent settings are updated only once the batch is finished.
+	 * @see USettingsWidget::SetSettingsBatch */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Setters")
+	FORCEINLINE bool IsSettingsBatchActive() const { return SettingsEngineInternal.IsBatchActive(); }
+
+	/** Returns the total amount of setting writes skipped since the value is the same as already set,
+	 * so neither the setter, nor the sub-widget, nor OnAnySettingSet were called for them. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Setters")
+	FORCEINLINE int32 GetRedundantWritesAvoided() const { return SettingsEngineInternal.GetRedundantWritesNum(); }
+
+	/** Returns how this widget and its columns cache their Slate content, is taken from the Settings Data Asset unless overridden. */
+	ESettingsInvalidationMode GetInvalidationMode() const;
+
+#if !UE_BUILD_SHIPPING
+	/** Overrides the invalidation mode of this widget, e.g: to compare them in benchmarks, is taken into account on next rebuild of the widget.
+	 * @param InInvalidationMode The mode to use, if not set then the mode from the Settings Data Asset is used. */
+	void SetInvalidationModeOverride(TOptional<ESettingsInvalidationMode> InInvalidationMode) { InvalidationModeOverrideInternal = InInvalidationMode; }
+#endif // !UE_BUILD_SHIPPING
+
+	/** Sets all values of specified snapshot, e.g: to apply the graphics preset.
+	 * Only settings which current values differ from the snapshot are set, then all of them are applied once.
+	 * @param Snapshot The values to set, is usually captured by CaptureSettingsSnapshot or loaded from the user save.
+	 * @param bSaveSettings If true, all settings are saved into their configs once the snapshot is set. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "Snapshot"))
+	void ApplySettingsSnapshot(const FSettingsSnapshot& Snapshot, bool bSaveSettings = false);
+
 	/** Creates setting sub-widget (like button, checkbox etc.) based on specified setting class and sets it to specified primary data.
 	 * @param InOutPrimary The Data that should contain created setting class.
 	 * @param SettingSubWidgetClass The setting widget class to create. */
@@ -224,19 +316,135 @@ public:
 	template <typename T = USettingSubWidget>
 	FORCEINLINE T* GetSettingSubWidget(const FSettingTag& SettingTag) const { return Cast<T>(GetSettingSubWidget(SettingTag)); }
 
+	/** Get values of many settings at once in a string format.
+	 * @param SettingTags Tags of settings to get, parent tags return all their children, e.g: 'Settings.Checkbox' returns all checkboxes.
+	 * @param OutSettingValues The value in a string format by the setting tag. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "SettingTags"))
+	void GetSettingsBatch(UPARAM(meta = (Categories = "Settings")) const FGameplayTagContainer& SettingTags, TMap<FGameplayTag, FString>& OutSettingValues) const;
+
+	/** Captures current values of settings, so they can be diffed, applied later or stored in the user save.
+	 * @param SettingTags Tags of settings to capture, parent tags capture all their children, if empty then all settings are captured.
+	 * @param OutSnapshot Captured values in the order of settings. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "SettingTags"))
+	void CaptureSettingsSnapshot(UPARAM(meta = (Categories = "Settings")) const FGameplayTagContainer& SettingTags, FSettingsSnapshot& OutSnapshot) const;
+
+	/* ---------------------------------------------------
+	 *		Getters and setters by handles
+	 * --------------------------------------------------- */
+public:
+	/** Returns the handle of the setting by specified tag, is resolved once and then used instead of the tag to avoid the lookup on each call, e.g: when the setting is polled every frame.
+	 * The handle becomes stale once settings are rebuilt or removed: getters return default values and setters do nothing, so resolve it again.
+	 * @param SettingTag The gameplay tag by which the setting will be found.
+	 * @return The empty handle if the setting is not found. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "SettingTag"))
+	FSettingHandle ResolveSettingHandle(const FSettingTag& SettingTag) const;
+
+	/** Returns true if specified handle still points to its setting, is false once settings are rebuilt or removed. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "SettingHandle"))
+	bool IsSettingHandleValid(const FSettingHandle& SettingHandle) const;
+
+	/** Returns the found row by specified handle or empty row if the handle is stale. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "SettingHandle"))
+	const FSettingsPicker& GetSettingRowByHandle(const FSettingHandle& SettingHandle) const;
+
+	/** Press button by specified handle. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "ButtonHandle"))
+	void SetSettingButtonPressedByHandle(const FSettingHandle& ButtonHandle);
+
+	/** Toggle checkbox by specified handle. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "CheckboxHandle"))
+	void SetSettingCheckboxByHandle(const FSettingHandle& CheckboxHandle, bool InValue);
+
+	/** Set chosen member index for a combobox by specified handle. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "ComboboxHandle"))
+	void SetSettingComboboxIndexByHandle(const FSettingHandle& ComboboxHandle, int32 InValue);
+
+	/** Set current value for a slider [0...1] by specified handle. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "SliderHandle"))
+	void SetSettingSliderByHandle(const FSettingHandle& SliderHandle, double InValue);
+
+	/** Set new text by specified handle. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "TextLineHandle,InValue"))
+	void SetSettingTextLineByHandle(const FSettingHandle& TextLineHandle, const FText& InValue);
+
+	/** Set new text for an input box by specified handle. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "UserInputHandle"))
+	void SetSettingUserInputByHandle(const FSettingHandle& UserInputHandle, FName InValue);
+
+	/** Set new custom widget for setting by specified handle. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "CustomWidgetHandle"))
+	void SetSettingCustomWidgetByHandle(const FSettingHandle& CustomWidgetHandle, class USettingCustomWidget* InCustomWidget);
+
+	/** Returns is a checkbox toggled by specified handle. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "CheckboxHandle"))
+	bool GetCheckboxValueByHandle(const FSettingHandle& CheckboxHandle) const;
+
+	/** Returns chosen member index of a combobox by specified handle. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "ComboboxHandle"))
+	int32 GetComboboxIndexByHandle(const FSettingHandle& ComboboxHandle) const;
+
+	/** Get all members of a combobox by specified handle. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "ComboboxHandle"))
+	void GetComboboxMembersByHandle(const FSettingHandle& ComboboxHandle, TArray<FText>& OutMembers) const;
+
+	/** Get current value of a slider [0...1] by specified handle. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "SliderHandle"))
+	double GetSliderValueByHandle(const FSettingHandle& SliderHandle) const;
+
+	/** Get current text of the text line setting by specified handle. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "TextLineHandle"))
+	void GetTextLineValueByHandle(const FSettingHandle& TextLineHandle, FText& OutText) const;
+
+	/** Get current input name of the text input setting by specified handle. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "UserInputHandle"))
+	FName GetUserInputValueByHandle(const FSettingHandle& UserInputHandle) const;
+
+	/** Get custom widget of the setting by specified handle. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "CustomWidgetHandle"))
+	class USettingCustomWidget* GetCustomWidgetByHandle(const FSettingHandle& CustomWidgetHandle) const;
+
+	/** Get setting widget object by specified handle. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Handles", meta = (AutoCreateRefTerm = "SettingHandle"))
+	class USettingSubWidget* GetSettingSubWidgetByHandle(const FSettingHandle& SettingHandle) const;
+
+	template <typename T = USettingSubWidget>
+	FORCEINLINE T* GetSettingSubWidgetByHandle(const FSettingHandle& SettingHandle) const { return Cast<T>(GetSettingSubWidgetByHandle(SettingHandle)); }
+
 	/* ---------------------------------------------------
 	 *		Protected properties
 	 * --------------------------------------------------- */
 protected:
-	/** Contains all settings. */
-	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Transient, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Settings Table Rows"))
-	TMap<FName/*Tag*/, FSettingsPicker/*Row*/> SettingsTableRowsInternal;
+	/** Contains all settings bound to this player, sets their values, refreshes their dependent settings and tracks batches,
+	 * while this widget binds rows to sub-widgets and shows their changes.
+	 * @see USettingsWidget::OnEngineSettingChanged */
+	FSettingsEngine SettingsEngineInternal;
 
 	/** Contains all Setting tags that failed to bind their Getter/Setter functions on initial construct, so it's stored to be rebound later.
 	 * @see USettingsWidget::TryRebindDeferredContexts */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, AdvancedDisplay, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "DeferredBindings"))
 	FGameplayTagContainer DeferredBindingsInternal;
 
+#if !UE_BUILD_SHIPPING
+	/** If set, overrides the invalidation mode from the Settings Data Asset.
+	 * @see USettingsWidget::GetInvalidationMode */
+	TOptional<ESettingsInvalidationMode> InvalidationModeOverrideInternal;
+#endif // !UE_BUILD_SHIPPING
+
+	/** Row indices of settings changed outside of the widget while it's closed, are refreshed on next open.
+	 * @see USettingsWidget::NotifySettingChanged */
+	TArray<int32> DirtyRowIndicesInternal;
+
+	/** Is true when all settings have to be refreshed on next open regardless of the refresh policy. */
+	bool bAllSettingsDirtyInternal = false;
+
+	/** Is bound to the culture change while settings are constructed.
+	 * @see USettingsWidget::OnCultureChanged */
+	FDelegateHandle CultureChangedHandleInternal;
+
+	/** Is bound to the next Slate tick while scrollboxes height is pending, is removed once the height is set.
+	 * @see USettingsWidget::UpdateScrollBoxesHeight */
+	FDelegateHandle ScrollBoxesHeightHandleInternal;
+
 	/* ---------------------------------------------------
 	 *		Bound widget properties
 	 * --------------------------------------------------- */
@@ -277,6 +485,16 @@ protected:
 	/** Called when the widget is removed from the viewport. */
 	virtual void NativeDestruct() override;
 
+	/** Is overridden to wrap the whole settings into the invalidation root according to the invalidation mode.
+	 * @see USettingsWidget::GetInvalidationMode */
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+#if !UE_BUILD_SHIPPING
+	/** Paints the latency profiler overlay over settings if it's enabled.
+	 * @see FSettingsLatencyProfiler */
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+#endif // !UE_BUILD_SHIPPING
+
 	/** Is called right after the game was started and windows size is set to construct settings. */
 	void OnViewportResizedWhenInit(class FViewport* Viewport, uint32 Index);
 
@@ -293,14 +511,39 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
 	void RemoveAllSettings();
 
+	/** Updates texts of all constructed settings in place after the culture is changed instead of rebuilding the whole menu. */
+	void OnCultureChanged();
+
+	/** Is called by the settings engine after the value of any setting is changed to show it on UI. */
+	void OnEngineSettingChanged(const FSettingTag& SettingTag);
+
+	/** Shows the current value of the row by specified index on its sub-widget. */
+	void RefreshSettingSubWidget(int32 RowIndex);
+
+	/** Refreshes settings on UI when the widget is opened according to the refresh policy.
+	 * @see USettingsDataAsset::OpenRefreshPolicyInternal */
+	void RefreshSettingsOnOpen();
+
 	/** Is called when In-Game menu became opened or closed. */
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
 	void OnToggleSettings(bool bIsVisible);
 
-	/** Automatically sets the height for all scrollboxes in the Settings. */
+	/** Automatically sets the height for all scrollboxes in the Settings.
+	 * Is deferred once to the start of the next Slate tick, so settings are already added, but not painted yet. */
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
 	void UpdateScrollBoxesHeight();
 
+	/** Sets the height for all scrollboxes right away, only header and footer are measured instead of the whole tree.
+	 * @return false if header or footer is not built yet to be measured. */
+	bool ApplyScrollBoxesHeight();
+
+	/** Is called once on the start of the Slate tick after the scrollboxes height was requested, before anything is painted.
+	 * @see USettingsWidget::UpdateScrollBoxesHeight */
+	void OnPreTickScrollBoxesHeight(float DeltaTime);
+
+	/** Stops waiting for the next Slate tick to set the scrollboxes height. */
+	void CancelScrollBoxesHeight();
+
 	/* ---------------------------------------------------
 	 *		Bind by setting types
 	 * --------------------------------------------------- */
@@ -378,6 +621,20 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Columns", meta = (BlueprintProtected))
 	void AddColumn(int32 ColumnIndex);
 
+	/*********************************************************************************************
+	 * Tooltip
+	 ********************************************************************************************* */
+public:
+	/** Returns the tooltip widget shared by all settings, is created on first request.
+	 * Only one tooltip is visible at once, so its text is set on hover by the hovered setting. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Tooltip")
+	class USettingTooltip* GetSharedTooltip();
+
+protected:
+	/** The tooltip widget shared by all settings. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Transient, AdvancedDisplay, Category = "Settings Widget Constructor|Tooltip", meta = (BlueprintProtected, DisplayName = "Shared Tooltip"))
+	TObjectPtr<class USettingTooltip> SharedTooltipInternal = nullptr;
+
 	/*********************************************************************************************
 	 * Multiple Data Tables support
 	 ********************************************************************************************* */
@@ -386,6 +643,44 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
 	void OnSettingsDataRegistryChanged(class UDataRegistry* SettingsDataRegistry);
 	void BindOnSettingsDataRegistryChanged();
+
+#if !UE_BUILD_SHIPPING
+public:
+	/** Sets Settings Data Tables to be used instead of ones registered in the Settings Data Registry, e.g: to benchmark generated tables.
+	 * Empty array resets the override, settings have to be reconstructed to take effect.
+	 * The caller keeps given tables alive while they are used. */
+	void SetDataTablesOverride(const TArray<const class USettingsDataTable*>& InDataTables);
+
+protected:
+	/** If set, settings are generated from these Settings Data Tables instead of the Settings Data Registry.
+	 * @see USettingsWidget::SetDataTablesOverride */
+	TArray<TWeakObjectPtr<const class USettingsDataTable>> DataTablesOverrideInternal;
+#endif // !UE_BUILD_SHIPPING
+
+	/*********************************************************************************************
+	 * Deferred Apply
+	 ********************************************************************************************* */
+public:
+	/** Returns true if settings are requested to be applied at the end of this frame. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE bool IsApplySettingsPending() const { return bPendingApplySettingsInternal; }
+
+protected:
+	/** Is true when settings are requested to be applied at the end of this frame.
+	 * @see USettingsWidget::ApplySettingsDeferred */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Transient, AdvancedDisplay, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Pending Apply Settings"))
+	bool bPendingApplySettingsInternal = false;
+
+	/** Is true when the pending apply has to reapply the resolution as well. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Transient, AdvancedDisplay, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Pending Apply Resolution"))
+	bool bPendingApplyResolutionInternal = false;
+
+protected:
+	/** Is called at the end of the frame to apply all settings requested by USettingsWidget::ApplySettingsDeferred. */
+	void OnEndFrameApplySettings();
+
+	/** Resets pending apply state and stops listening the end of the frame. */
+	void ClearPendingApplySettings();
 };
 
 /** Helper to update setting by specified function.
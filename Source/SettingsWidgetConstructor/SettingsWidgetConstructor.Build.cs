@@ -26,6 +26,16 @@ public class SettingsWidgetConstructor : ModuleRules
 			}
 		);
 
+		if (Target.Configuration != UnrealTargetConfiguration.Shipping)
+		{
+			// Include modules that are used only by the settings benchmark, it is not compiled into shipping builds
+			PrivateDependencyModuleNames.AddRange(new[]
+				{
+					"Json" // Benchmark reports
+				}
+			);
+		}
+
 		if (Target.bBuildEditor)
 		{
 			// Include Editor modules that are used in this Runtime module
@@ -0,0 +1,331 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "SettingsWidgetConstructorValidateCommandlet.h"
+//---
+#include "SettingsWidgetConstructorModule.h"
+#include "Data/SettingsDataTable.h"
+#include "Data/SettingsRow.h"
+//---
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DataValidation.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsWidgetConstructorValidateCommandlet)
+
+// Default constructor
+USettingsWidgetConstructorValidateCommandlet::USettingsWidgetConstructorValidateCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+// Is overridden to validate all Settings Data Tables and write the report
+int32 USettingsWidgetConstructorValidateCommandlet::Main(const FString& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FString ReportPath = GetDefaultReportPath();
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+	const bool bWarningsAsErrors = FParse::Param(*Params, TEXT("WarningsAsErrors"));
+
+	// Load
+	TArray<const USettingsDataTable*> DataTables;
+	LoadAllSettingDataTables(DataTables);
+	const double LoadTime = FPlatformTime::Seconds();
+
+	// Rows are not copied, but referenced right in tables
+	TArray<FRowEntry> Entries;
+	for (const USettingsDataTable* DataTableIt : DataTables)
+	{
+		for (const TTuple<FName, uint8*>& RowIt : DataTableIt->GetRowMap())
+		{
+			FRowEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.Table = DataTableIt;
+			Entry.RowName = RowIt.Key;
+			Entry.Row = reinterpret_cast<const FSettingsRow*>(RowIt.Value);
+		}
+	}
+
+	TArray<FIssue> Issues;
+	ValidateRows(Entries, Issues);
+	const double RowsTime = FPlatformTime::Seconds();
+
+	ValidateTags(Entries, Issues);
+	const double TagsTime = FPlatformTime::Seconds();
+
+	ValidateDependencies(Entries, Issues);
+	const double DependenciesTime = FPlatformTime::Seconds();
+
+	// Report
+	int32 ErrorsNum = 0;
+	int32 WarningsNum = 0;
+	TArray<TSharedPtr<FJsonValue>> JsonIssues;
+	JsonIssues.Reserve(Issues.Num());
+	for (const FIssue& IssueIt : Issues)
+	{
+		const bool bIsError = IssueIt.Severity == EIssueSeverity::Error;
+		bIsError ? ++ErrorsNum : ++WarningsNum;
+
+		const TSharedRef<FJsonObject> JsonIssue = MakeShared<FJsonObject>();
+		JsonIssue->SetStringField(TEXT("check"), IssueIt.Check);
+		JsonIssue->SetStringField(TEXT("severity"), bIsError ? TEXT("error") : TEXT("warning"));
+		JsonIssue->SetStringField(TEXT("table"), IssueIt.Table);
+		JsonIssue->SetStringField(TEXT("row"), IssueIt.RowName.ToString());
+		JsonIssue->SetStringField(TEXT("message"), IssueIt.Message);
+		JsonIssues.Emplace(MakeShared<FJsonValueObject>(JsonIssue));
+
+		if (bIsError)
+		{
+			UE_LOG(LogSettingsWidgetConstructor, Error, TEXT("[%s] %s: %s: %s"), *IssueIt.Check, *IssueIt.Table, *IssueIt.RowName.ToString(), *IssueIt.Message);
+		}
+		else
+		{
+			UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("[%s] %s: %s: %s"), *IssueIt.Check, *IssueIt.Table, *IssueIt.RowName.ToString(), *IssueIt.Message);
+		}
+	}
+
+	TArray<TSharedPtr<FJsonValue>> JsonTables;
+	JsonTables.Reserve(DataTables.Num());
+	for (const USettingsDataTable* DataTableIt : DataTables)
+	{
+		JsonTables.Emplace(MakeShared<FJsonValueString>(DataTableIt->GetPathName()));
+	}
+
+	const TSharedRef<FJsonObject> JsonTimings = MakeShared<FJsonObject>();
+	JsonTimings->SetNumberField(TEXT("loadMs"), (LoadTime - StartTime) * 1000.0);
+	JsonTimings->SetNumberField(TEXT("rowsMs"), (RowsTime - LoadTime) * 1000.0);
+	JsonTimings->SetNumberField(TEXT("tagsMs"), (TagsTime - RowsTime) * 1000.0);
+	JsonTimings->SetNumberField(TEXT("dependenciesMs"), (DependenciesTime - TagsTime) * 1000.0);
+	JsonTimings->SetNumberField(TEXT("totalMs"), (DependenciesTime - StartTime) * 1000.0);
+
+	const TSharedRef<FJsonObject> JsonRoot = MakeShared<FJsonObject>();
+	JsonRoot->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	JsonRoot->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	JsonRoot->SetArrayField(TEXT("tables"), JsonTables);
+	JsonRoot->SetNumberField(TEXT("rows"), Entries.Num());
+	JsonRoot->SetNumberField(TEXT("errors"), ErrorsNum);
+	JsonRoot->SetNumberField(TEXT("warnings"), WarningsNum);
+	JsonRoot->SetObjectField(TEXT("timings"), JsonTimings);
+	JsonRoot->SetArrayField(TEXT("issues"), JsonIssues);
+
+	FString JsonString;
+	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(JsonRoot, JsonWriter);
+	if (!FFileHelper::SaveStringToFile(JsonString, *ReportPath))
+	{
+		UE_LOG(LogSettingsWidgetConstructor, Error, TEXT("%hs: failed to write the report to '%s'"), __FUNCTION__, *ReportPath);
+		return 1;
+	}
+
+	UE_LOG(LogSettingsWidgetConstructor, Display, TEXT("Validated %i rows of %i tables in %.2f ms: %i errors, %i warnings, the report is written to '%s'"),
+	       Entries.Num(), DataTables.Num(), (DependenciesTime - StartTime) * 1000.0, ErrorsNum, WarningsNum, *ReportPath);
+
+	const bool bFailed = ErrorsNum > 0 || (bWarningsAsErrors && WarningsNum > 0);
+	return bFailed ? 1 : 0;
+}
+
+// Returns the path of the report by default
+FString USettingsWidgetConstructorValidateCommandlet::GetDefaultReportPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SettingsWidgetConstructor") / TEXT("Validation") / TEXT("SettingsValidation.json");
+}
+
+// Loads all Settings Data Tables of the project by the asset registry, so it works even if the Settings Data Registry is not initialized
+void USettingsWidgetConstructorValidateCommandlet::LoadAllSettingDataTables(TArray<const USettingsDataTable*>& OutDataTables)
+{
+	OutDataTables.Reset();
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(/*bSynchronousSearch*/ true);
+
+	TArray<FAssetData> AssetsData;
+	AssetRegistry.GetAssetsByClass(USettingsDataTable::StaticClass()->GetClassPathName(), /*Out*/ AssetsData, /*bSearchSubClasses*/ true);
+
+	OutDataTables.Reserve(AssetsData.Num());
+	for (const FAssetData& AssetDataIt : AssetsData)
+	{
+		if (const USettingsDataTable* DataTable = Cast<USettingsDataTable>(AssetDataIt.GetAsset()))
+		{
+			OutDataTables.Emplace(DataTable);
+		}
+	}
+}
+
+// Validates each row by itself in parallel
+void USettingsWidgetConstructorValidateCommandlet::ValidateRows(TConstArrayView<FRowEntry> Entries, TArray<FIssue>& OutIssues)
+{
+	// Each row writes only to own slot, so nothing is shared between threads
+	TArray<TArray<FIssue>> RowIssues;
+	RowIssues.SetNum(Entries.Num());
+
+	ParallelFor(Entries.Num(), [&Entries, &RowIssues](int32 EntryIndex)
+	{
+		const FRowEntry& Entry = Entries[EntryIndex];
+		FDataValidationContext Context;
+		Entry.Row->SettingsPicker.IsDataValid(Context);
+
+		TArray<FText> Warnings;
+		TArray<FText> Errors;
+		Context.SplitIssues(/*Out*/ Warnings, /*Out*/ Errors);
+
+		auto AddIssues = [&Entry, &Issues = RowIssues[EntryIndex]](const TArray<FText>& Messages, EIssueSeverity Severity)
+		{
+			for (const FText& MessageIt : Messages)
+			{
+				FIssue& Issue = Issues.AddDefaulted_GetRef();
+				Issue.Check = TEXT("Row");
+				Issue.Table = Entry.Table->GetPathName();
+				Issue.RowName = Entry.RowName;
+				Issue.Message = MessageIt.ToString();
+				Issue.Severity = Severity;
+			}
+		};
+		AddIssues(Errors, EIssueSeverity::Error);
+		AddIssues(Warnings, EIssueSeverity::Warning);
+	});
+
+	for (TArray<FIssue>& IssuesIt : RowIssues)
+	{
+		OutIssues.Append(MoveTemp(IssuesIt));
+	}
+}
+
+// Finds tags that are used by more than one row across all tables, and 'Show Next To Setting Override' tags of missing rows
+void USettingsWidgetConstructorValidateCommandlet::ValidateTags(TConstArrayView<FRowEntry> Entries, TArray<FIssue>& OutIssues)
+{
+	TMap<FName, int32> EntryIndexByTag;
+	EntryIndexByTag.Reserve(Entries.Num());
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		const FRowEntry& Entry = Entries[EntryIndex];
+		const FName TagName = Entry.Row->SettingsPicker.PrimaryData.Tag.GetTagName();
+		if (TagName.IsNone())
+		{
+			// Is already reported by the row validation
+			continue;
+		}
+
+		if (const int32* FoundEntryIndex = EntryIndexByTag.Find(TagName))
+		{
+			const FRowEntry& FoundEntry = Entries[*FoundEntryIndex];
+			FIssue& Issue = OutIssues.AddDefaulted_GetRef();
+			Issue.Check = TEXT("DuplicateTag");
+			Issue.Table = Entry.Table->GetPathName();
+			Issue.RowName = Entry.RowName;
+			Issue.Message = FString::Printf(TEXT("Tag '%s' is already used by the row '%s' of the table '%s', only one of them will be shown"), *TagName.ToString(), *FoundEntry.RowName.ToString(), *FoundEntry.Table->GetPathName());
+			continue;
+		}
+
+		EntryIndexByTag.Emplace(TagName, EntryIndex);
+	}
+
+	for (const FRowEntry& Entry : Entries)
+	{
+		const FSettingTag& OverrideTag = Entry.Row->SettingsPicker.PrimaryData.ShowNextToSettingOverride;
+		if (OverrideTag.IsValid()
+		    && !EntryIndexByTag.Contains(OverrideTag.GetTagName()))
+		{
+			FIssue& Issue = OutIssues.AddDefaulted_GetRef();
+			Issue.Check = TEXT("OrphanedOverride");
+			Issue.Table = Entry.Table->GetPathName();
+			Issue.RowName = Entry.RowName;
+			Issue.Message = FString::Printf(TEXT("'Show Next To Setting Override' is set to '%s', but there is no such setting in any table"), *OverrideTag.ToString());
+		}
+	}
+}
+
+// Finds cycles of 'Settings To Update', where updated settings would update each other endlessly
+void USettingsWidgetConstructorValidateCommandlet::ValidateDependencies(TConstArrayView<FRowEntry> Entries, TArray<FIssue>& OutIssues)
+{
+	// Resolve dependencies the same way the Settings Widget does, so parent tags match all their children
+	TArray<TArray<int32>> Dependencies;
+	Dependencies.SetNum(Entries.Num());
+	ParallelFor(Entries.Num(), [&Entries, &Dependencies](int32 EntryIndex)
+	{
+		const FGameplayTagContainer& SettingsToUpdate = Entries[EntryIndex].Row->SettingsPicker.PrimaryData.SettingsToUpdate;
+		if (SettingsToUpdate.IsEmpty())
+		{
+			return;
+		}
+
+		for (int32 OtherIndex = 0; OtherIndex < Entries.Num(); ++OtherIndex)
+		{
+			const FSettingTag& OtherTag = Entries[OtherIndex].Row->SettingsPicker.PrimaryData.Tag;
+			if (OtherTag.IsValid()
+			    && OtherTag.MatchesAny(SettingsToUpdate))
+			{
+				Dependencies[EntryIndex].Emplace(OtherIndex);
+			}
+		}
+	});
+
+	// Iterative depth-first search, where the edge to the row that is still in the path closes the cycle
+	enum class EVisitState : uint8 { NotVisited, InPath, Done };
+	TArray<EVisitState> States;
+	States.Init(EVisitState::NotVisited, Entries.Num());
+
+	TArray<TPair<int32/*EntryIndex*/, int32/*NextDependency*/>> Path;
+	for (int32 RootIndex = 0; RootIndex < Entries.Num(); ++RootIndex)
+	{
+		if (States[RootIndex] != EVisitState::NotVisited)
+		{
+			continue;
+		}
+
+		Path.Emplace(RootIndex, 0);
+		States[RootIndex] = EVisitState::InPath;
+		while (!Path.IsEmpty())
+		{
+			TPair<int32, int32>& Top = Path.Last();
+			const TArray<int32>& TopDependencies = Dependencies[Top.Key];
+			if (!TopDependencies.IsValidIndex(Top.Value))
+			{
+				States[Top.Key] = EVisitState::Done;
+				Path.Pop(EAllowShrinking::No);
+				continue;
+			}
+
+			const int32 NextIndex = TopDependencies[Top.Value++];
+			if (States[NextIndex] == EVisitState::NotVisited)
+			{
+				States[NextIndex] = EVisitState::InPath;
+				Path.Emplace(NextIndex, 0);
+				continue;
+			}
+
+			if (States[NextIndex] != EVisitState::InPath)
+			{
+				continue;
+			}
+
+			// Collect the cycle from the row it starts from
+			FString CycleString;
+			bool bIsInCycle = false;
+			for (const TPair<int32, int32>& PathIt : Path)
+			{
+				bIsInCycle |= PathIt.Key == NextIndex;
+				if (bIsInCycle)
+				{
+					CycleString += Entries[PathIt.Key].Row->SettingsPicker.PrimaryData.Tag.ToString() + TEXT(" -> ");
+				}
+			}
+			CycleString += Entries[NextIndex].Row->SettingsPicker.PrimaryData.Tag.ToString();
+
+			const FRowEntry& Entry = Entries[NextIndex];
+			FIssue& Issue = OutIssues.AddDefaulted_GetRef();
+			Issue.Check = TEXT("Cycle");
+			Issue.Table = Entry.Table->GetPathName();
+			Issue.RowName = Entry.RowName;
+			Issue.Message = FString::Printf(TEXT("'Settings To Update' have the cycle, it stops only if values stay the same: %s"), *CycleString);
+			Issue.Severity = EIssueSeverity::Warning;
+		}
+	}
+}
@@ -0,0 +1,76 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+//---
+#include "SettingsWidgetConstructorValidateCommandlet.generated.h"
+
+class USettingsDataTable;
+struct FSettingsRow;
+
+/**
+ * Loads all Settings Data Tables of the project and validates them headless, e.g: in CI on Linux:
+ * UnrealEditor-Cmd <Project>.uproject -run=SettingsWidgetConstructorValidate [-Report=<Path>.json] [-Unattended -NullRHI]
+ * Rows are validated in parallel: tags, chosen types, owner, getter and setter functions.
+ * Then all tables are checked together: duplicate tags across tables, orphaned 'Show Next To Setting Override' and cycles of 'Settings To Update'.
+ * Writes the machine-readable JSON report with all issues and timings, returns non-zero exit code if any error is found.
+ */
+UCLASS()
+class SETTINGSWIDGETCONSTRUCTOREDITOR_API USettingsWidgetConstructorValidateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	/** Severity of the found issue. */
+	enum class EIssueSeverity : uint8
+	{
+		Warning,
+		Error
+	};
+
+	/** The issue found in the row. */
+	struct FIssue
+	{
+		/** The name of the check that found this issue, e.g: 'Row', 'DuplicateTag', 'Cycle'. */
+		FString Check;
+
+		/** The path of the table and the name of the row with this issue. */
+		FString Table;
+		FName RowName = NAME_None;
+
+		/** The description of this issue. */
+		FString Message;
+
+		EIssueSeverity Severity = EIssueSeverity::Error;
+	};
+
+	/** The row to validate with its table. */
+	struct FRowEntry
+	{
+		const USettingsDataTable* Table = nullptr;
+		FName RowName = NAME_None;
+		const FSettingsRow* Row = nullptr;
+	};
+
+	/** Default constructor. */
+	USettingsWidgetConstructorValidateCommandlet();
+
+	/** Is overridden to validate all Settings Data Tables and write the report. */
+	virtual int32 Main(const FString& Params) override;
+
+	/** Returns the path of the report by default. */
+	static FString GetDefaultReportPath();
+
+	/** Loads all Settings Data Tables of the project by the asset registry, so it works even if the Settings Data Registry is not initialized. */
+	static void LoadAllSettingDataTables(TArray<const USettingsDataTable*>& OutDataTables);
+
+	/** Validates each row by itself in parallel. */
+	static void ValidateRows(TConstArrayView<FRowEntry> Entries, TArray<FIssue>& OutIssues);
+
+	/** Finds tags that are used by more than one row across all tables, and 'Show Next To Setting Override' tags of missing rows. */
+	static void ValidateTags(TConstArrayView<FRowEntry> Entries, TArray<FIssue>& OutIssues);
+
+	/** Finds cycles of 'Settings To Update', where updated settings would update each other endlessly. */
+	static void ValidateDependencies(TConstArrayView<FRowEntry> Entries, TArray<FIssue>& OutIssues);
+};
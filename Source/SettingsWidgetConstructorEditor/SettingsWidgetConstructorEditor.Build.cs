@@ -27,6 +27,7 @@ public class SettingsWidgetConstructorEditor : ModuleRules
 				, "ToolWidgets" // SSearchableComboBox
 				, "DataTableEditor", "DesktopPlatform", "EditorFramework", "ToolMenus" // Editor data table
 				, "UMG", "Kismet", "KismetCompiler" // Editor user widget
+				, "AssetRegistry", "Json" // SettingsWidgetConstructorValidate commandlet
 				// My modules
 				, "SettingsWidgetConstructor" // USettingsDataTable
 			}